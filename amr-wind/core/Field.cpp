@@ -177,6 +177,32 @@ void Field::fillpatch(
     fop.fillpatch(lev, time, mfab, nghost, field_state());
 }
 
+bool Field::fillpatch_begin(
+    const int lev,
+    const amrex::Real time,
+    amrex::MultiFab& mfab,
+    const amrex::IntVect& nghost) noexcept
+{
+    BL_PROFILE("amr-wind::Field::fillpatch_begin");
+    BL_ASSERT(m_info->m_fillpatch_op);
+    BL_ASSERT(m_info->bc_initialized() && m_info->m_bc_copied_to_device);
+    auto& fop = *(m_info->m_fillpatch_op);
+
+    return fop.fillpatch_begin(lev, time, mfab, nghost, field_state());
+}
+
+void Field::fillpatch_end(
+    const int lev,
+    const amrex::Real time,
+    amrex::MultiFab& mfab,
+    const amrex::IntVect& nghost) noexcept
+{
+    BL_PROFILE("amr-wind::Field::fillpatch_end");
+    auto& fop = *(m_info->m_fillpatch_op);
+
+    fop.fillpatch_end(lev, time, mfab, nghost, field_state());
+}
+
 void Field::fillpatch_from_coarse(
     const int lev,
     const amrex::Real time,
@@ -0,0 +1,71 @@
+#include "amr-wind/core/FieldGroup.H"
+#include "amr-wind/core/Field.H"
+#include "amr-wind/core/FieldRepo.H"
+
+#include "AMReX.H"
+#include "AMReX_BLProfiler.H"
+
+namespace amr_wind {
+
+void FieldGroup::add(Field& field) { add(field, field.num_grow()); }
+
+void FieldGroup::add(Field& field, const amrex::IntVect& ng)
+{
+    AMREX_ALWAYS_ASSERT(!m_active);
+    for (const auto& entry : m_fields) {
+        if (entry.field == &field) {
+            amrex::Abort(
+                "FieldGroup: field " + field.name() + " added more than once");
+        }
+    }
+    m_fields.push_back(Entry{&field, ng, false});
+}
+
+void FieldGroup::fillpatch_begin(const amrex::Real time)
+{
+    BL_PROFILE("amr-wind::FieldGroup::fillpatch_begin");
+    AMREX_ALWAYS_ASSERT(!m_active);
+    m_active = true;
+    m_time = time;
+
+    // Post the level 0 exchanges of all the fields, and fill in place the
+    // fields whose fillpatch operation cannot be split
+    for (auto& entry : m_fields) {
+        auto& fld = *entry.field;
+        entry.started = fld.fillpatch_begin(0, time, fld(0), entry.ng);
+        if (!entry.started) {
+            fld.fillpatch(0, time, fld(0), entry.ng);
+        }
+    }
+}
+
+void FieldGroup::fillpatch_end()
+{
+    BL_PROFILE("amr-wind::FieldGroup::fillpatch_end");
+    AMREX_ALWAYS_ASSERT(m_active);
+
+    for (auto& entry : m_fields) {
+        if (entry.started) {
+            auto& fld = *entry.field;
+            fld.fillpatch_end(0, m_time, fld(0), entry.ng);
+            entry.started = false;
+        }
+    }
+
+    for (auto& entry : m_fields) {
+        auto& fld = *entry.field;
+        const int nlevels = fld.repo().num_active_levels();
+        for (int lev = 1; lev < nlevels; ++lev) {
+            fld.fillpatch(lev, m_time, fld(lev), entry.ng);
+        }
+    }
+    m_active = false;
+}
+
+void FieldGroup::fillpatch(const amrex::Real time)
+{
+    fillpatch_begin(time);
+    fillpatch_end();
+}
+
+} // namespace amr_wind
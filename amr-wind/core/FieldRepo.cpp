@@ -16,6 +16,7 @@ void FieldRepo::make_new_level_from_scratch(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::make_new_level_from_scratch");
+    clear_scratch_pool();
     m_leveldata[lev] = std::make_unique<LevelDataHolder>();
 
     allocate_field_data(
@@ -33,6 +34,7 @@ void FieldRepo::make_new_level_from_coarse(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::make_level_from_coarse");
+    clear_scratch_pool();
     std::unique_ptr<LevelDataHolder> ldata(new LevelDataHolder());
 
     allocate_field_data(ba, dm, *ldata, *(ldata->m_factory));
@@ -57,6 +59,7 @@ void FieldRepo::remake_level(
     const amrex::DistributionMapping& dm)
 {
     BL_PROFILE("amr-wind::FieldRepo::remake_level");
+    clear_scratch_pool();
     std::unique_ptr<LevelDataHolder> ldata(new LevelDataHolder());
 
     allocate_field_data(ba, dm, *ldata, *(ldata->m_factory));
@@ -74,9 +77,26 @@ void FieldRepo::remake_level(
     m_is_initialized = true;
 }
 
+void FieldRepo::enable_scratch_pool(const bool flag)
+{
+    if (flag && !m_scratch_pool) {
+        m_scratch_pool = std::make_shared<ScratchFieldPool>();
+    } else if (!flag) {
+        m_scratch_pool.reset();
+    }
+}
+
+void FieldRepo::clear_scratch_pool()
+{
+    if (m_scratch_pool) {
+        m_scratch_pool->clear();
+    }
+}
+
 void FieldRepo::clear_level(int lev)
 {
     BL_PROFILE("amr-wind::FieldRepo::clear_level");
+    clear_scratch_pool();
     m_leveldata[lev].reset();
 }
 
@@ -314,6 +334,15 @@ std::unique_ptr<ScratchField> FieldRepo::create_scratch_field(
     std::unique_ptr<ScratchField> field(
         new ScratchField(*this, name, ncomp, nghost, floc));
 
+    if (m_scratch_pool) {
+        field->m_pool = m_scratch_pool;
+        field->m_pool_generation = m_scratch_pool->generation();
+        if (m_scratch_pool->acquire(
+                {ncomp, nghost, floc, num_active_levels()}, field->m_data)) {
+            return field;
+        }
+    }
+
     for (int lev = 0; lev <= m_mesh.finestLevel(); ++lev) {
         const auto ba =
             amrex::convert(m_mesh.boxArray(lev), field_impl::index_type(floc));
@@ -322,6 +351,10 @@ std::unique_ptr<ScratchField> FieldRepo::create_scratch_field(
             ba, m_mesh.DistributionMap(lev), ncomp, nghost, amrex::MFInfo(),
             *(m_leveldata[lev]->m_factory));
     }
+
+    if (m_scratch_pool) {
+        m_scratch_pool->record_allocation(field->m_data);
+    }
     return field;
 }
 
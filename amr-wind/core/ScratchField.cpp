@@ -47,6 +47,15 @@ scratch_field_bcrec(const amrex::Geometry& geom, const int ncomp)
 
 } // namespace
 
+ScratchField::~ScratchField()
+{
+    if (auto pool = m_pool.lock()) {
+        pool->release(
+            {m_ncomp, m_ngrow[0], m_floc, static_cast<int>(m_data.size())},
+            m_pool_generation, std::move(m_data));
+    }
+}
+
 void ScratchField::fillpatch(const amrex::Real time) noexcept
 {
     fillpatch(time, num_grow());
@@ -0,0 +1,88 @@
+#include "amr-wind/core/ScratchFieldPool.H"
+
+#include <algorithm>
+
+#include "AMReX_BLProfiler.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_Print.H"
+
+namespace amr_wind {
+
+bool ScratchFieldPool::acquire(const Key& key, DataType& data)
+{
+    auto found = m_free.find(key);
+    if ((found == m_free.end()) || found->second.empty()) {
+        return false;
+    }
+
+    data = std::move(found->second.back());
+    found->second.pop_back();
+    ++m_stats.num_reuses;
+    ++m_stats.num_live;
+    m_stats.max_live = std::max(m_stats.max_live, m_stats.num_live);
+    return true;
+}
+
+void ScratchFieldPool::record_allocation(const DataType& data)
+{
+    ++m_stats.num_allocs;
+    ++m_stats.num_live;
+    m_stats.max_live = std::max(m_stats.max_live, m_stats.num_live);
+    m_stats.bytes += num_bytes(data);
+    m_stats.max_bytes = std::max(m_stats.max_bytes, m_stats.bytes);
+}
+
+void ScratchFieldPool::release(
+    const Key& key, const int generation, DataType&& data)
+{
+    --m_stats.num_live;
+    // Discard stale data as well as data moved out of the scratch field
+    const bool valid = std::all_of(
+        data.begin(), data.end(), [](const auto& mf) { return mf.ok(); });
+    if ((generation != m_generation) || !valid) {
+        m_stats.bytes -= num_bytes(data);
+        return;
+    }
+    m_free[key].push_back(std::move(data));
+}
+
+void ScratchFieldPool::clear()
+{
+    BL_PROFILE("amr-wind::ScratchFieldPool::clear");
+    for (const auto& item : m_free) {
+        for (const auto& data : item.second) {
+            m_stats.bytes -= num_bytes(data);
+        }
+    }
+    m_free.clear();
+    ++m_generation;
+}
+
+void ScratchFieldPool::print_stats() const
+{
+    amrex::Long max_bytes = static_cast<amrex::Long>(m_stats.max_bytes);
+    int max_live = m_stats.max_live;
+    amrex::ParallelDescriptor::ReduceLongMax(
+        max_bytes, amrex::ParallelDescriptor::IOProcessorNumber());
+    amrex::ParallelDescriptor::ReduceIntMax(
+        max_live, amrex::ParallelDescriptor::IOProcessorNumber());
+
+    amrex::Print() << "Scratch field pool: " << m_stats.num_allocs
+                   << " allocations, " << m_stats.num_reuses
+                   << " reuses, high-water mark " << max_live
+                   << " fields, " << max_bytes / (1024 * 1024)
+                   << " MB per process" << std::endl;
+}
+
+size_t ScratchFieldPool::num_bytes(const DataType& data)
+{
+    size_t nbytes = 0;
+    for (const auto& mf : data) {
+        for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+            nbytes += mf[mfi].nBytes();
+        }
+    }
+    return nbytes;
+}
+
+} // namespace amr_wind
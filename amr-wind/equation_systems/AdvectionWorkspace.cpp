@@ -0,0 +1,98 @@
+#include "amr-wind/equation_systems/AdvectionWorkspace.H"
+
+#include "AMReX_OpenMP.H"
+
+namespace amr_wind::pde {
+
+AdvectionWorkspace::AdvectionWorkspace(
+    FieldRepo& repo,
+    const int num_fields,
+    const int num_tile_fabs,
+    const bool persistent)
+    : m_repo(repo)
+    , m_fields(num_fields)
+    , m_num_tile_fabs(num_tile_fabs)
+    , m_persistent(persistent)
+{
+#ifndef AMREX_USE_GPU
+    if (m_persistent) {
+        // Only resized by the owning thread, which also touches it first
+        m_tile_fabs.resize(amrex::OpenMP::get_max_threads());
+        for (auto& fabs : m_tile_fabs) {
+            fabs.resize(num_tile_fabs);
+        }
+    }
+#endif
+}
+
+bool AdvectionWorkspace::mesh_changed() const
+{
+    const auto& mesh = m_repo.mesh();
+    const int nlevels = m_repo.num_active_levels();
+    if (nlevels != static_cast<int>(m_ba.size())) {
+        return true;
+    }
+    for (int lev = 0; lev < nlevels; ++lev) {
+        if ((mesh.boxArray(lev) != m_ba[lev]) ||
+            (mesh.DistributionMap(lev) != m_dm[lev])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+ScratchField& AdvectionWorkspace::field(
+    const int slot, const int ncomp, const int nghost, const FieldLoc floc)
+{
+    AMREX_ASSERT((slot >= 0) && (slot < static_cast<int>(m_fields.size())));
+
+    if (mesh_changed()) {
+        for (auto& fld : m_fields) {
+            fld.reset();
+        }
+        const auto& mesh = m_repo.mesh();
+        const int nlevels = m_repo.num_active_levels();
+        m_ba.resize(nlevels);
+        m_dm.resize(nlevels);
+        for (int lev = 0; lev < nlevels; ++lev) {
+            m_ba[lev] = mesh.boxArray(lev);
+            m_dm[lev] = mesh.DistributionMap(lev);
+        }
+    }
+
+    auto& fld = m_fields[slot];
+    if (!fld || (fld->num_comp() != ncomp) ||
+        (fld->num_grow() != amrex::IntVect(nghost)) ||
+        (fld->field_location() != floc)) {
+        fld = m_repo.create_scratch_field(ncomp, nghost, floc);
+    }
+    return *fld;
+}
+
+amrex::FArrayBox AdvectionWorkspace::tile_fab(
+    const int slot, const amrex::Box& bx, const int ncomp)
+{
+    AMREX_ASSERT((slot >= 0) && (slot < m_num_tile_fabs));
+
+    if (m_tile_fabs.empty()) {
+        return amrex::FArrayBox(bx, ncomp, amrex::The_Async_Arena());
+    }
+
+    // The buffer is only reallocated when it is too small
+    auto& fab = m_tile_fabs[amrex::OpenMP::get_thread_num()][slot];
+    fab.resize(bx, ncomp);
+    return amrex::FArrayBox(fab, amrex::make_alias, 0, ncomp);
+}
+
+void AdvectionWorkspace::release()
+{
+    if (!m_persistent) {
+        for (auto& fld : m_fields) {
+            fld.reset();
+        }
+        m_ba.clear();
+        m_dm.clear();
+    }
+}
+
+} // namespace amr_wind::pde
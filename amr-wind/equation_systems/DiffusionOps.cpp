@@ -14,6 +14,7 @@ DiffSolverIface<LinOp>::DiffSolverIface(
     : m_pdefields(fields)
     , m_density(fields.repo.get_field("density"))
     , m_options(prefix, m_pdefields.field.name() + "_" + prefix)
+    , m_has_overset(has_overset)
     , m_mesh_mapping(mesh_mapping)
 {
     amrex::LPInfo isolve = m_options.lpinfo();
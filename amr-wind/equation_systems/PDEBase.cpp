@@ -2,6 +2,7 @@
 #include "amr-wind/equation_systems/SchemeTraits.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/core/FieldRepo.H"
+#include "amr-wind/core/FieldGroup.H"
 #include "amr-wind/equation_systems/PDEHelpers.H"
 #include "amr-wind/incflo_enums.H"
 #include "amr-wind/core/field_ops.H"
@@ -214,14 +215,16 @@ void PDEMgr::density_check()
 void PDEMgr::fillpatch_state_fields(
     const amrex::Real time, const FieldState fstate)
 {
+    FieldGroup group;
     if (m_constant_density) {
-        m_sim.repo().get_field("density").state(fstate).fillpatch(time);
+        group.add(m_sim.repo().get_field("density").state(fstate));
     }
 
-    icns().fields().field.state(fstate).fillpatch(time);
+    group.add(icns().fields().field.state(fstate));
     for (auto& eqn : scalar_eqns()) {
-        eqn->fields().field.state(fstate).fillpatch(time);
+        group.add(eqn->fields().field.state(fstate));
     }
+    group.fillpatch(time);
 }
 
 } // namespace amr_wind::pde
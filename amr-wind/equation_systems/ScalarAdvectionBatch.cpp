@@ -0,0 +1,216 @@
+#include "amr-wind/equation_systems/ScalarAdvectionBatch.H"
+#include "amr-wind/equation_systems/PDEFields.H"
+#include "amr-wind/equation_systems/SchemeTraits.H"
+#include "amr-wind/utilities/PerfLog.H"
+
+#include "AMReX_MultiFabUtil.H"
+#include "AMReX_ParmParse.H"
+#include "hydro_utils.H"
+
+namespace amr_wind::pde {
+
+ScalarAdvectionBatch::ScalarAdvectionBatch(FieldRepo& repo) : m_repo(repo)
+{
+    // Invalid options are rejected by the advection operators of the
+    // individual equations
+    amrex::ParmParse pp("incflo");
+    pp.query("godunov_type", m_godunov_type);
+    pp.query("godunov_use_forces_in_trans", m_use_forces_in_trans);
+
+    const auto gtype = amrex::toLower(m_godunov_type);
+    if (gtype == "plm") {
+        m_godunov_scheme = godunov::scheme::PLM;
+    } else if (gtype == "ppm") {
+        m_godunov_scheme = godunov::scheme::PPM;
+    } else if (gtype == "ppm_nolim") {
+        m_godunov_scheme = godunov::scheme::PPM_NOLIM;
+    } else if (gtype == "bds") {
+        m_godunov_scheme = godunov::scheme::BDS;
+        m_advection_type = "BDS";
+    } else if ((gtype == "weno") || (gtype == "weno_js")) {
+        m_godunov_scheme = godunov::scheme::WENO_JS;
+    } else {
+        m_godunov_scheme = godunov::scheme::WENOZ;
+    }
+}
+
+void ScalarAdvectionBatch::init_bcs(const amrex::Vector<PDEBase*>& eqns)
+{
+    const int ncomp = static_cast<int>(eqns.size());
+    m_bcrec.clear();
+    for (auto* eqn : eqns) {
+        const auto& bcrec = eqn->fields().field.bcrec();
+        AMREX_ALWAYS_ASSERT(bcrec.size() == 1);
+        m_bcrec.push_back(bcrec[0]);
+    }
+    m_bcrec_d.resize(ncomp);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_bcrec.begin(), m_bcrec.end(),
+        m_bcrec_d.begin());
+
+    // All the scalars are advected in conservative form
+    m_iconserv.resize(ncomp, 1);
+
+    m_eqns = eqns;
+}
+
+void ScalarAdvectionBatch::compute(
+    const amrex::Vector<PDEBase*>& eqns,
+    const FieldState fstate,
+    const amrex::Real dt)
+{
+    BL_PROFILE("amr-wind::ScalarAdvectionBatch::compute");
+    PerfLog::Timer timer(PerfLog::Advection);
+
+    if (eqns != m_eqns) {
+        init_bcs(eqns);
+    }
+
+    const int ncomp = static_cast<int>(eqns.size());
+    const int nlevels = m_repo.num_active_levels();
+    const auto& geom = m_repo.mesh().Geom();
+
+    auto& density = m_repo.get_field("density");
+    const auto& den = density.state(fstate);
+    const auto& den_nph = density.state(FieldState::NPH);
+    const auto& u_mac = m_repo.get_field("u_mac");
+    const auto& v_mac = m_repo.get_field("v_mac");
+    const auto& w_mac = m_repo.get_field("w_mac");
+
+    // Conserved quantities and source terms of all the scalars
+    const amrex::IntVect ng_state(fvm::Godunov::nghost_state);
+    const amrex::IntVect ng_src(fvm::Godunov::nghost_src);
+    auto rhotrac = m_repo.create_scratch_field(ncomp, ng_state[0]);
+    auto rhotrac_nph = m_repo.create_scratch_field(ncomp, ng_state[0]);
+    auto srctrac = m_repo.create_scratch_field(ncomp, ng_src[0]);
+    auto divu = m_repo.create_scratch_field(1, 1);
+    divu->setVal(0.0);
+
+    auto flux_x = m_repo.create_scratch_field(ncomp, 0, FieldLoc::XFACE);
+    auto flux_y = m_repo.create_scratch_field(ncomp, 0, FieldLoc::YFACE);
+    auto flux_z = m_repo.create_scratch_field(ncomp, 0, FieldLoc::ZFACE);
+    auto face_x = m_repo.create_scratch_field(ncomp, 0, FieldLoc::XFACE);
+    auto face_y = m_repo.create_scratch_field(ncomp, 0, FieldLoc::YFACE);
+    auto face_z = m_repo.create_scratch_field(ncomp, 0, FieldLoc::ZFACE);
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& rt_arrs = (*rhotrac)(lev).arrays();
+        const auto& rt_nph_arrs = (*rhotrac_nph)(lev).arrays();
+        const auto& src_arrs = (*srctrac)(lev).arrays();
+        const auto& rho_arrs = den(lev).const_arrays();
+        const auto& rho_nph_arrs = den_nph(lev).const_arrays();
+        for (int n = 0; n < ncomp; ++n) {
+            const auto& fields = eqns[n]->fields();
+            const auto& tra_arrs =
+                fields.field.state(fstate)(lev).const_arrays();
+            const auto& tra_nph_arrs =
+                fields.field.state(FieldState::NPH)(lev).const_arrays();
+            const auto& fsrc_arrs = fields.src_term(lev).const_arrays();
+            amrex::ParallelFor(
+                (*rhotrac)(lev), ng_state,
+                [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                    rt_arrs[nbx](i, j, k, n) =
+                        rho_arrs[nbx](i, j, k) * tra_arrs[nbx](i, j, k);
+                    rt_nph_arrs[nbx](i, j, k, n) =
+                        rho_nph_arrs[nbx](i, j, k) * tra_nph_arrs[nbx](i, j, k);
+                });
+            amrex::ParallelFor(
+                (*srctrac)(lev), ng_src,
+                [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                    src_arrs[nbx](i, j, k, n) = fsrc_arrs[nbx](i, j, k);
+                });
+        }
+    }
+
+    const bool is_velocity = false;
+    const bool known_edge_state = false;
+    const bool fluxes_are_area_weighted = false;
+    const bool allow_inflow_on_outflow = false;
+    const bool godunov_use_ppm =
+        ((m_godunov_scheme != godunov::scheme::PLM) &&
+         (m_godunov_scheme != godunov::scheme::BDS));
+    int limiter_type;
+    if (m_godunov_scheme == godunov::scheme::PPM_NOLIM) {
+        limiter_type = PPM::NoLimiter;
+    } else if (m_godunov_scheme == godunov::scheme::WENOZ) {
+        limiter_type = PPM::WENOZ;
+    } else if (m_godunov_scheme == godunov::scheme::WENO_JS) {
+        limiter_type = PPM::WENO_JS;
+    } else {
+        limiter_type = PPM::default_limiter;
+    }
+
+    // if state is NPH, then n and n+1 are known, and only spatial
+    // extrapolation is performed
+    const amrex::Real dt_extrap = (fstate == FieldState::NPH) ? 0.0 : dt;
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        amrex::MFItInfo mfi_info;
+        if (amrex::Gpu::notInLaunchRegion()) {
+            mfi_info.EnableTiling(amrex::IntVect(1024, 1024, 1024))
+                .SetDynamic(true);
+        }
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi((*rhotrac)(lev), mfi_info); mfi.isValid();
+             ++mfi) {
+            const auto& bx = mfi.tilebox();
+
+            HydroUtils::ComputeFluxesOnBoxFromState(
+                bx, ncomp, mfi, (*rhotrac)(lev).array(mfi),
+                (*rhotrac_nph)(lev).array(mfi), (*flux_x)(lev).array(mfi),
+                (*flux_y)(lev).array(mfi), (*flux_z)(lev).array(mfi),
+                (*face_x)(lev).array(mfi), (*face_y)(lev).array(mfi),
+                (*face_z)(lev).array(mfi), known_edge_state,
+                u_mac(lev).const_array(mfi), v_mac(lev).const_array(mfi),
+                w_mac(lev).const_array(mfi), (*divu)(lev).array(mfi),
+                (*srctrac)(lev).const_array(mfi), geom[lev], dt_extrap,
+                m_bcrec, m_bcrec_d.data(), m_iconserv.data(), godunov_use_ppm,
+                m_use_forces_in_trans, is_velocity, fluxes_are_area_weighted,
+                m_advection_type, limiter_type, allow_inflow_on_outflow);
+        }
+    }
+
+    amrex::Vector<amrex::Array<amrex::MultiFab*, AMREX_SPACEDIM>> fluxes(
+        nlevels);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        fluxes[lev][0] = &(*flux_x)(lev);
+        fluxes[lev][1] = &(*flux_y)(lev);
+        fluxes[lev][2] = &(*flux_z)(lev);
+    }
+
+    // In order to enforce conservation across coarse-fine boundaries we
+    // must be sure to average down the fluxes before we use them
+    for (int lev = nlevels - 1; lev > 0; --lev) {
+        amrex::IntVect rr =
+            geom[lev].Domain().size() / geom[lev - 1].Domain().size();
+        amrex::average_down_faces(
+            GetArrOfConstPtrs(fluxes[lev]), fluxes[lev - 1], rr,
+            geom[lev - 1]);
+    }
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+        for (amrex::MFIter mfi((*rhotrac)(lev), amrex::TilingIfNotGPU());
+             mfi.isValid(); ++mfi) {
+            const auto& bx = mfi.tilebox();
+            const auto& fx = (*flux_x)(lev).array(mfi);
+            const auto& fy = (*flux_y)(lev).array(mfi);
+            const auto& fz = (*flux_z)(lev).array(mfi);
+
+            for (int n = 0; n < ncomp; ++n) {
+                HydroUtils::ComputeDivergence(
+                    bx, eqns[n]->fields().conv_term(lev).array(mfi),
+                    amrex::Array4<amrex::Real>(fx, n, 1),
+                    amrex::Array4<amrex::Real>(fy, n, 1),
+                    amrex::Array4<amrex::Real>(fz, n, 1), 1, geom[lev],
+                    amrex::Real(-1.0), fluxes_are_area_weighted);
+            }
+        }
+    }
+}
+
+} // namespace amr_wind::pde
@@ -0,0 +1,148 @@
+#include "amr-wind/equation_systems/ScalarDiffusionBatch.H"
+#include "amr-wind/equation_systems/PDEFields.H"
+#include "amr-wind/diffusion/diffusion.H"
+#include "amr-wind/utilities/console_io.H"
+#include "amr-wind/utilities/PerfLog.H"
+
+#include "AMReX_MLMG.H"
+
+namespace amr_wind::pde {
+
+ScalarDiffusionBatch::ScalarDiffusionBatch(FieldRepo& repo)
+    : m_repo(repo), m_options("diffusion")
+{}
+
+void ScalarDiffusionBatch::post_regrid_actions()
+{
+    m_solver.reset();
+    m_eqns.clear();
+}
+
+void ScalarDiffusionBatch::init_operator(const amrex::Vector<PDEBase*>& eqns)
+{
+    BL_PROFILE("amr-wind::ScalarDiffusionBatch::init_operator");
+
+    const auto& mesh = m_repo.mesh();
+    const int ncomp = static_cast<int>(eqns.size());
+    m_solver = std::make_unique<amrex::MLABecLaplacian>(
+        mesh.Geom(0, mesh.finestLevel()), mesh.boxArray(0, mesh.finestLevel()),
+        mesh.DistributionMap(0, mesh.finestLevel()), m_options.lpinfo(),
+        amrex::Vector<amrex::FabFactory<amrex::FArrayBox> const*>(), ncomp);
+    m_solver->setMaxOrder(m_options.max_order);
+
+    amrex::Vector<amrex::Array<amrex::LinOpBCType, AMREX_SPACEDIM>> lobc;
+    amrex::Vector<amrex::Array<amrex::LinOpBCType, AMREX_SPACEDIM>> hibc;
+    for (auto* eqn : eqns) {
+        auto& field = eqn->fields().field;
+        lobc.push_back(
+            diffusion::get_diffuse_scalar_bc(field, amrex::Orientation::low));
+        hibc.push_back(
+            diffusion::get_diffuse_scalar_bc(field, amrex::Orientation::high));
+    }
+    m_solver->setDomainBC(lobc, hibc);
+
+    m_eqns = eqns;
+}
+
+void ScalarDiffusionBatch::solve(
+    const amrex::Vector<PDEBase*>& eqns, const amrex::Real dt)
+{
+    BL_PROFILE("amr-wind::ScalarDiffusionBatch::solve");
+    PerfLog::Timer timer(PerfLog::Diffusion);
+
+    if (!m_solver || (eqns != m_eqns)) {
+        init_operator(eqns);
+    }
+
+    const int ncomp = static_cast<int>(eqns.size());
+    const int nlevels = m_repo.num_active_levels();
+    const auto& geom = m_repo.mesh().Geom();
+    const auto& density = m_repo.get_field("density");
+
+    for (auto* eqn : eqns) {
+        eqn->prepare_batched_diffusion();
+    }
+
+    // Gather the scalars, including the boundary values in the ghost cells
+    auto sol = m_repo.create_scratch_field(ncomp, 1);
+    auto rhs = m_repo.create_scratch_field(ncomp, 0);
+    for (int n = 0; n < ncomp; ++n) {
+        const auto& field = eqns[n]->fields().field;
+        for (int lev = 0; lev < nlevels; ++lev) {
+            amrex::MultiFab::Copy((*sol)(lev), field(lev), 0, n, 1, 1);
+        }
+    }
+
+    // Normalize each scalar to O(1) so that the shared convergence check on
+    // the max-norm of the residual applies to every component
+    amrex::Vector<amrex::Real> scale(ncomp, 0.0);
+    for (int n = 0; n < ncomp; ++n) {
+        for (int lev = 0; lev < nlevels; ++lev) {
+            scale[n] =
+                amrex::max(scale[n], (*sol)(lev).norm0(n, 1, true, true));
+        }
+    }
+    amrex::ParallelDescriptor::ReduceRealMax(scale.data(), ncomp);
+    for (int n = 0; n < ncomp; ++n) {
+        if (scale[n] <= 0.0) {
+            scale[n] = 1.0;
+        }
+        for (int lev = 0; lev < nlevels; ++lev) {
+            (*sol)(lev).mult(1.0 / scale[n], n, 1, 1);
+        }
+    }
+
+    m_solver->setScalars(1.0, dt);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        m_solver->setLevelBC(lev, &(*sol)(lev));
+        m_solver->setACoeffs(lev, density(lev));
+
+        const auto& ba = (*sol)(lev).boxArray();
+        const auto& dm = (*sol)(lev).DistributionMap();
+        amrex::Array<amrex::MultiFab, AMREX_SPACEDIM> bcoeffs;
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            bcoeffs[dir].define(
+                amrex::convert(ba, amrex::IntVect::TheDimensionVector(dir)),
+                dm, ncomp, 0);
+        }
+        for (int n = 0; n < ncomp; ++n) {
+            auto b = diffusion::average_velocity_eta_to_faces(
+                geom[lev], eqns[n]->fields().mueff(lev));
+            for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+                amrex::MultiFab::Copy(bcoeffs[dir], b[dir], 0, n, 1, 0);
+            }
+        }
+        m_solver->setBCoeffs(lev, amrex::GetArrOfConstPtrs(bcoeffs));
+
+        // Always multiply with rho since there is no diffusion term for
+        // density
+        const auto& rhs_arrs = (*rhs)(lev).arrays();
+        const auto& sol_arrs = (*sol)(lev).const_arrays();
+        const auto& rho_arrs = density(lev).const_arrays();
+        amrex::ParallelFor(
+            (*rhs)(lev), amrex::IntVect(0), ncomp,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
+                rhs_arrs[nbx](i, j, k, n) =
+                    rho_arrs[nbx](i, j, k) * sol_arrs[nbx](i, j, k, n);
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+
+    amrex::MLMG mlmg(*m_solver);
+    m_options(mlmg);
+    mlmg.solve(
+        sol->vec_ptrs(), rhs->vec_const_ptrs(), m_options.rel_tol,
+        m_options.abs_tol);
+
+    io::print_mlmg_info("scalar_batch_solve", mlmg);
+
+    for (int n = 0; n < ncomp; ++n) {
+        auto& field = eqns[n]->fields().field;
+        for (int lev = 0; lev < nlevels; ++lev) {
+            amrex::MultiFab::Copy(field(lev), (*sol)(lev), n, 0, 1, 0);
+            field(lev).mult(scale[n], 0, 1, 0);
+        }
+    }
+}
+
+} // namespace amr_wind::pde
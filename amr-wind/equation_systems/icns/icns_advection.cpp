@@ -4,9 +4,11 @@
 #include "amr-wind/equation_systems/icns/icns_advection.H"
 #include "amr-wind/core/MLMGOptions.H"
 #include "amr-wind/utilities/console_io.H"
+#include "amr-wind/utilities/PerfLog.H"
 #include "amr-wind/wind_energy/ABL.H"
 #include "amr-wind/ocean_waves/OceanWaves.H"
 #include "amr-wind/overset/overset_ops_routines.H"
+#include "amr-wind/projection/fft_utils.H"
 
 #include "AMReX_MultiFabUtil.H"
 #include "hydro_MacProjector.H"
@@ -37,6 +39,57 @@ amrex::Array<amrex::LinOpBCType, AMREX_SPACEDIM> get_projection_bc(
     return r;
 }
 
+#ifdef AMR_WIND_USE_FFT
+/** Initial guess of a multi-level MAC projection with constant coefficient
+ *
+ *  Level 0 covers the whole domain, so the level 0 problem is solved exactly
+ *  with FFTs. The solution is interpolated (piecewise constant) to the finer
+ *  levels so that the composite MLMG solve only has to correct for the
+ *  refinement.
+ */
+void fft_coarse_guess(
+    amrex::FFT::Poisson<amrex::MultiFab>& fft,
+    const amrex::Vector<amrex::Array<amrex::MultiFab*, ICNS::ndim>>& mac_vec,
+    const amrex::AmrCore& mesh,
+    const amrex::Real beta,
+    ScratchField& phi)
+{
+    BL_PROFILE("amr-wind::ICNS::fft_coarse_guess");
+
+    // Solve lap(soln) = div(u), then div(beta grad(phi)) = div(u) for
+    // phi = soln / beta
+    auto& phi0 = phi(0);
+    amrex::MultiFab rhs(phi0.boxArray(), phi0.DistributionMap(), 1, 0);
+    amrex::MultiFab soln(phi0.boxArray(), phi0.DistributionMap(), 1, 0);
+    amrex::computeDivergence(
+        rhs, amrex::GetArrOfConstPtrs(mac_vec[0]), mesh.Geom(0));
+    fft.solve(soln, rhs);
+    phi0.setVal(0.0);
+    amrex::MultiFab::Saxpy(phi0, 1.0 / beta, soln, 0, 0, 1, 0);
+
+    for (int lev = 1; lev < static_cast<int>(mac_vec.size()); ++lev) {
+        auto& phif = phi(lev);
+        const amrex::IntVect rr = mesh.refRatio(lev - 1);
+        amrex::MultiFab crse(
+            amrex::coarsen(phif.boxArray(), rr), phif.DistributionMap(), 1, 0);
+        crse.ParallelCopy(
+            phi(lev - 1), 0, 0, 1, 0, 0, mesh.Geom(lev - 1).periodicity());
+
+        phif.setVal(0.0);
+        const auto& phif_arrs = phif.arrays();
+        const auto& crse_arrs = crse.const_arrays();
+        amrex::ParallelFor(
+            phif, amrex::IntVect(0),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                const amrex::IntVect civ =
+                    amrex::coarsen(amrex::IntVect(i, j, k), rr);
+                phif_arrs[nbx](i, j, k) = crse_arrs[nbx](civ);
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+#endif
+
 } // namespace
 
 MacProjOp::MacProjOp(
@@ -60,6 +113,7 @@ MacProjOp::MacProjOp(
     {
         amrex::ParmParse pp("mac_proj");
         pp.query("use_fft", m_use_fft);
+        pp.query("use_fft_coarse_guess", m_use_fft_coarse);
     }
 #endif
 }
@@ -136,6 +190,12 @@ void MacProjOp::init_projector(const amrex::Real beta) noexcept
             }
         }
     }
+    m_fft_coarse.reset();
+    if (m_use_fft_coarse && (m_repo.num_active_levels() > 1) &&
+        !m_has_overset) {
+        m_fft_coarse = std::make_unique<amrex::FFT::Poisson<amrex::MultiFab>>(
+            m_repo.mesh().Geom(0), projection::get_fft_bc(lobc, hibc));
+    }
 #endif
 
     m_mac_proj = std::make_unique<Hydro::MacProjector>(
@@ -207,6 +267,7 @@ void MacProjOp::set_inflow_velocity(amrex::Real time)
 void MacProjOp::operator()(const FieldState fstate, const amrex::Real dt)
 {
     BL_PROFILE("amr-wind::ICNS::advection_mac_project");
+    PerfLog::Timer timer(PerfLog::MACProjection);
     const auto& geom = m_repo.mesh().Geom();
     auto& u_mac = m_repo.get_field("u_mac");
     auto& v_mac = m_repo.get_field("v_mac");
@@ -347,6 +408,14 @@ void MacProjOp::operator()(const FieldState fstate, const amrex::Real dt)
 #ifdef AMR_WIND_USE_FFT
         if (m_fft_mac_proj) {
             m_fft_mac_proj->project();
+        } else if (m_fft_coarse) {
+            auto phif =
+                m_repo.create_scratch_field(1, 1, amr_wind::FieldLoc::CELL);
+            fft_coarse_guess(
+                *m_fft_coarse, mac_vec, m_repo.mesh(), factor / m_rho_0,
+                *phif);
+            m_mac_proj->project(
+                phif->vec_ptrs(), m_options.rel_tol, m_options.abs_tol);
         } else
 #endif
         {
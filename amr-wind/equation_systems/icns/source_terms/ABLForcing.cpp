@@ -2,7 +2,6 @@
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/wind_energy/ABL.H"
 #include "amr-wind/physics/multiphase/MultiPhase.H"
-#include "amr-wind/equation_systems/vof/volume_fractions.H"
 #include "amr-wind/utilities/trig_ops.H"
 
 #include "AMReX_ParmParse.H"
@@ -88,50 +87,32 @@ void ABLForcing::operator()(
     const int lev,
     const amrex::MFIter& mfi,
     const amrex::Box& bx,
-    const FieldState /*fstate*/,
+    const FieldState fstate,
     const amrex::Array4<amrex::Real>& src_term) const
 {
-
-    const amrex::Real dudt = m_abl_forcing[0];
-    const amrex::Real dvdt = m_abl_forcing[1];
-
-    const bool ph_ramp = m_use_phase_ramp;
-    const int n_band = m_n_band;
-    const amrex::Real wlev = m_water_level;
-    const amrex::Real wrht0 = m_forcing_mphase0;
-    const amrex::Real wrht1 = m_forcing_mphase1;
-    const auto& problo = m_mesh.Geom(lev).ProbLoArray();
-    const auto& dx = m_mesh.Geom(lev).CellSizeArray();
-
-    const auto& vof = (*m_vof)(lev).const_array(mfi);
+    const auto op = device_op(lev, mfi, fstate);
     amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        amrex::Real fac = 1.0;
-        if (ph_ramp) {
-            const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
-            if (z - wlev < wrht0 + wrht1) {
-                if (z - wlev < wrht0) {
-                    // Apply no forcing within first interval
-                    fac = 0.0;
-                } else {
-                    // Ramp from 0 to 1 over second interval
-                    fac =
-                        0.5 - 0.5 * std::cos(M_PI * (z - wlev - wrht0) / wrht1);
-                }
-            }
-            // Check for presence of liquid (like a droplet)
-            // - interface_band checks for closeness to interface
-            // - need to also check for within liquid
-            if (multiphase::interface_band(i, j, k, vof, n_band) ||
-                vof(i, j, k) > 1.0 - 1e-12) {
-                // Turn off forcing
-                fac = 0.0;
-            }
-        }
-        src_term(i, j, k, 0) += fac * dudt;
-        src_term(i, j, k, 1) += fac * dvdt;
-
-        // No forcing in z-direction
+        op(i, j, k, src_term);
     });
 }
 
+ABLForcing::DeviceOp ABLForcing::device_op(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const FieldState /*fstate*/) const
+{
+    DeviceOp op;
+    op.dudt = m_abl_forcing[0];
+    op.dvdt = m_abl_forcing[1];
+    op.ph_ramp = m_use_phase_ramp;
+    op.n_band = m_n_band;
+    op.wlev = m_water_level;
+    op.wrht0 = m_forcing_mphase0;
+    op.wrht1 = m_forcing_mphase1;
+    op.problo = m_mesh.Geom(lev).ProbLoArray();
+    op.dx = m_mesh.Geom(lev).CellSizeArray();
+    op.vof = (*m_vof)(lev).const_array(mfi);
+    return op;
+}
+
 } // namespace amr_wind::pde::icns
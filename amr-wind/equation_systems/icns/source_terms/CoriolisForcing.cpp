@@ -60,43 +60,28 @@ void CoriolisForcing::operator()(
     const FieldState fstate,
     const amrex::Array4<amrex::Real>& src_term) const
 {
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> east{
-        m_east[0], m_east[1], m_east[2]};
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> north{
-        m_north[0], m_north[1], m_north[2]};
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> up{m_up[0], m_up[1], m_up[2]};
-
-    const auto sinphi = m_sinphi;
-    const auto cosphi = m_cosphi;
-    const auto corfac = m_coriolis_factor;
-    const auto& vel =
-        m_velocity.state(field_impl::dof_state(fstate))(lev).const_array(mfi);
-
-    amrex::Real fac = (m_is_horizontal) ? 0. : 1.;
-
+    const auto op = device_op(lev, mfi, fstate);
     amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        const amrex::Real ue = east[0] * vel(i, j, k, 0) +
-                               east[1] * vel(i, j, k, 1) +
-                               east[2] * vel(i, j, k, 2);
-        const amrex::Real un = north[0] * vel(i, j, k, 0) +
-                               north[1] * vel(i, j, k, 1) +
-                               north[2] * vel(i, j, k, 2);
-        const amrex::Real uu = up[0] * vel(i, j, k, 0) +
-                               up[1] * vel(i, j, k, 1) +
-                               up[2] * vel(i, j, k, 2);
-
-        const amrex::Real ae = +corfac * (un * sinphi - fac * uu * cosphi);
-        const amrex::Real an = -corfac * ue * sinphi;
-        const amrex::Real au = +fac * corfac * ue * cosphi;
-
-        const amrex::Real ax = ae * east[0] + an * north[0] + au * up[0];
-        const amrex::Real ay = ae * east[1] + an * north[1] + au * up[1];
-        const amrex::Real az = ae * east[2] + an * north[2] + au * up[2];
-
-        src_term(i, j, k, 0) += ax;
-        src_term(i, j, k, 1) += ay;
-        src_term(i, j, k, 2) += az;
+        op(i, j, k, src_term);
     });
 }
 
+CoriolisForcing::DeviceOp CoriolisForcing::device_op(
+    const int lev, const amrex::MFIter& mfi, const FieldState fstate) const
+{
+    DeviceOp op;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        op.east[d] = m_east[d];
+        op.north[d] = m_north[d];
+        op.up[d] = m_up[d];
+    }
+    op.sinphi = m_sinphi;
+    op.cosphi = m_cosphi;
+    op.corfac = m_coriolis_factor;
+    op.fac = (m_is_horizontal) ? 0. : 1.;
+    op.vel =
+        m_velocity.state(field_impl::dof_state(fstate))(lev).const_array(mfi);
+    return op;
+}
+
 } // namespace amr_wind::pde::icns
@@ -3,7 +3,6 @@
 #include "amr-wind/utilities/trig_ops.H"
 #include "amr-wind/core/vs/vstraits.H"
 #include "amr-wind/physics/multiphase/MultiPhase.H"
-#include "amr-wind/equation_systems/vof/volume_fractions.H"
 #include "amr-wind/utilities/linear_interpolation.H"
 
 #include "AMReX_ParmParse.H"
@@ -101,25 +100,31 @@ void GeostrophicForcing::operator()(
     const int lev,
     const amrex::MFIter& mfi,
     const amrex::Box& bx,
-    const FieldState /*fstate*/,
+    const FieldState fstate,
     const amrex::Array4<amrex::Real>& src_term) const
 {
-    amrex::Real hfac = (m_is_horizontal) ? 0. : 1.;
-    // Forces applied at n+1/2
-    const auto& nph_time = 0.5 * (m_time.current_time() + m_time.new_time());
-
-    const bool ph_ramp = m_use_phase_ramp;
-    const int n_band = m_n_band;
-    const amrex::Real wlev = m_water_level;
-    const amrex::Real wrht0 = m_forcing_mphase0;
-    const amrex::Real wrht1 = m_forcing_mphase1;
-    const auto& problo = m_mesh.Geom(lev).ProbLoArray();
-    const auto& dx = m_mesh.Geom(lev).CellSizeArray();
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> forcing{
-        m_g_forcing[0], m_g_forcing[1], m_g_forcing[2]};
+    const auto op = device_op(lev, mfi, fstate);
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        op(i, j, k, src_term);
+    });
+}
+
+GeostrophicForcing::DeviceOp GeostrophicForcing::device_op(
+    const int lev,
+    const amrex::MFIter& mfi,
+    const FieldState /*fstate*/) const
+{
+    DeviceOp op;
+    op.hfac = (m_is_horizontal) ? 0. : 1.;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        op.forcing[d] = m_g_forcing[d];
+    }
 
     // Calculate forcing values if target velocity is a function of time
     if (!m_vel_timetable.empty()) {
+        // Forces applied at n+1/2
+        const auto& nph_time =
+            0.5 * (m_time.current_time() + m_time.new_time());
         const amrex::Real nph_spd =
             amr_wind::interp::linear(m_time_table, m_speed_table, nph_time);
         const amrex::Real nph_dir = amr_wind::interp::linear_angle(
@@ -128,39 +133,20 @@ void GeostrophicForcing::operator()(
         const amrex::Real target_u = nph_spd * std::cos(nph_dir);
         const amrex::Real target_v = nph_spd * std::sin(nph_dir);
 
-        forcing[0] = -m_coriolis_factor * target_v;
-        forcing[1] = m_coriolis_factor * target_u;
-        forcing[2] = 0.0;
+        op.forcing[0] = -m_coriolis_factor * target_v;
+        op.forcing[1] = m_coriolis_factor * target_u;
+        op.forcing[2] = 0.0;
     }
 
-    const auto& vof = (*m_vof)(lev).const_array(mfi);
-    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        amrex::Real wfac = 1.0;
-        if (ph_ramp) {
-            const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
-            if (z - wlev < wrht0 + wrht1) {
-                if (z - wlev < wrht0) {
-                    // Apply no forcing within first interval
-                    wfac = 0.0;
-                } else {
-                    // Ramp from 0 to 1 over second interval
-                    wfac =
-                        0.5 - 0.5 * std::cos(M_PI * (z - wlev - wrht0) / wrht1);
-                }
-            }
-            // Check for presence of liquid (like a droplet)
-            // - interface_band checks for closeness to interface
-            // - need to also check for within liquid
-            if (multiphase::interface_band(i, j, k, vof, n_band) ||
-                vof(i, j, k) > 1.0 - 1e-12) {
-                // Turn off forcing
-                wfac = 0.0;
-            }
-        }
-        src_term(i, j, k, 0) += wfac * forcing[0];
-        src_term(i, j, k, 1) += wfac * forcing[1];
-        src_term(i, j, k, 2) += wfac * hfac * forcing[2];
-    });
+    op.ph_ramp = m_use_phase_ramp;
+    op.n_band = m_n_band;
+    op.wlev = m_water_level;
+    op.wrht0 = m_forcing_mphase0;
+    op.wrht1 = m_forcing_mphase1;
+    op.problo = m_mesh.Geom(lev).ProbLoArray();
+    op.dx = m_mesh.Geom(lev).CellSizeArray();
+    op.vof = (*m_vof)(lev).const_array(mfi);
+    return op;
 }
 
 } // namespace amr_wind::pde::icns
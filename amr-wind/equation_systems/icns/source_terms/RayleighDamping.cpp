@@ -36,44 +36,31 @@ void RayleighDamping::operator()(
     const FieldState fstate,
     const amrex::Array4<amrex::Real>& src_term) const
 {
-
-    const auto& problo = m_mesh.Geom(lev).ProbLoArray();
-    const auto& probhi = m_mesh.Geom(lev).ProbHiArray();
-    const auto& dx = m_mesh.Geom(lev).CellSizeArray();
-
-    const amrex::Real tau = m_tau;
-    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> ref_vel{
-        m_ref_vel[0], m_ref_vel[1], m_ref_vel[2]};
-    const auto& vel =
-        m_velocity.state(field_impl::dof_state(fstate))(lev).const_array(mfi);
-
-    // Constants used to determine the fringe region coefficient
-    const amrex::Real dRD = m_dRD;
-    const amrex::Real dFull = m_dFull;
-
-    // Which coordinate directions to force
-    const amrex::Real fx = m_fcoord[0];
-    const amrex::Real fy = m_fcoord[1];
-    const amrex::Real fz = m_fcoord[2];
-
+    const auto op = device_op(lev, mfi, fstate);
     amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        amrex::Real coeff = 0.0;
-        const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
-
-        if (probhi[2] - z > dRD + dFull) {
-            coeff = 0.0;
-        } else if (probhi[2] - z > dFull) {
-            coeff = 0.5 * std::cos(M_PI * (probhi[2] - dFull - z) / dRD) + 0.5;
-        } else {
-            coeff = 1.0;
-        }
-        src_term(i, j, k, 0) +=
-            fx * coeff * (ref_vel[0] - vel(i, j, k, 0)) / tau;
-        src_term(i, j, k, 1) +=
-            fy * coeff * (ref_vel[1] - vel(i, j, k, 1)) / tau;
-        src_term(i, j, k, 2) +=
-            fz * coeff * (ref_vel[2] - vel(i, j, k, 2)) / tau;
+        op(i, j, k, src_term);
     });
 }
 
+RayleighDamping::DeviceOp RayleighDamping::device_op(
+    const int lev, const amrex::MFIter& mfi, const FieldState fstate) const
+{
+    DeviceOp op;
+    op.problo = m_mesh.Geom(lev).ProbLoArray();
+    op.probhi = m_mesh.Geom(lev).ProbHiArray();
+    op.dx = m_mesh.Geom(lev).CellSizeArray();
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        op.ref_vel[d] = m_ref_vel[d];
+        // Which coordinate directions to force
+        op.fcoord[d] = m_fcoord[d];
+    }
+    op.tau = m_tau;
+    // Constants used to determine the fringe region coefficient
+    op.dRD = m_dRD;
+    op.dFull = m_dFull;
+    op.vel =
+        m_velocity.state(field_impl::dof_state(fstate))(lev).const_array(mfi);
+    return op;
+}
+
 } // namespace amr_wind::pde::icns
@@ -8,6 +8,49 @@ using namespace amrex;
 
 namespace amr_wind {
 
+amrex::Vector<int>
+multiphase::interface_boxes(amrex::MultiFab const& volfrac, const int margin)
+{
+    BL_PROFILE("amr-wind::multiphase::interface_boxes");
+    AMREX_ALWAYS_ASSERT(volfrac.nGrow() >= margin);
+
+    // Same threshold as eulerian_implicit()
+    constexpr amrex::Real tiny = 1e-12;
+    const int nboxes = volfrac.local_size();
+
+    // For every box, flags for non-empty and non-full cells
+    amrex::Gpu::DeviceVector<int> d_flags(2 * nboxes, 0);
+    auto* flags = d_flags.data();
+    const auto& vof_arrs = volfrac.const_arrays();
+    amrex::ParallelFor(
+        volfrac, amrex::IntVect(margin),
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+            const amrex::Real vof = vof_arrs[nbx](i, j, k);
+            // All threads write the same value, no atomics needed
+            if (vof > tiny && flags[2 * nbx] == 0) {
+                flags[2 * nbx] = 1;
+            }
+            if (std::abs(vof - 1.0) > tiny && flags[2 * nbx + 1] == 0) {
+                flags[2 * nbx + 1] = 1;
+            }
+        });
+
+    amrex::Vector<int> h_flags(2 * nboxes);
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, d_flags.begin(), d_flags.end(),
+        h_flags.begin());
+
+    amrex::Vector<int> states(nboxes);
+    for (int n = 0; n < nboxes; ++n) {
+        const bool non_empty = h_flags[2 * n] != 0;
+        const bool non_full = h_flags[2 * n + 1] != 0;
+        states[n] = (non_empty && non_full)
+                        ? box_interface
+                        : (non_empty ? box_full : box_empty);
+    }
+    return states;
+}
+
 void multiphase::split_advection_step(
     int isweep,
     int iorder,
@@ -23,10 +66,21 @@ void multiphase::split_advection_step(
     amrex::Vector<amrex::Geometry> geom,
     amrex::Real time,
     amrex::Real dt,
-    bool rm_debris)
+    bool rm_debris,
+    bool narrow_band)
 {
     BL_PROFILE("amr-wind::multiphase::split_advection_step");
 
+    // With narrow-band advection, the boxes away from the interface are not
+    // updated. Within a sweep the interface moves by at most one cell, and
+    // the reconstruction uses one more cell on each side.
+    amrex::Vector<amrex::Vector<int>> box_states(nlevels);
+    if (narrow_band) {
+        for (int lev = 0; lev < nlevels; ++lev) {
+            box_states[lev] = interface_boxes(dof_field(lev), 2);
+        }
+    }
+
     for (int lev = 0; lev < nlevels; ++lev) {
         amrex::MFItInfo mfi_info;
         if (amrex::Gpu::notInLaunchRegion()) {
@@ -39,16 +93,33 @@ void multiphase::split_advection_step(
         for (amrex::MFIter mfi(dof_field(lev), mfi_info); mfi.isValid();
              ++mfi) {
             const auto& bx = mfi.tilebox();
-            amrex::FArrayBox tmpfab(
-                amrex::grow(bx, 1), 2, amrex::The_Async_Arena());
-            tmpfab.setVal<amrex::RunOn::Device>(0.0);
 
-            // Compression term coefficient
+            // Compression term coefficient, needed by all boxes since the
+            // interface can reach them in the later sweeps
             if (iorder == 0) {
                 multiphase::cmask_loop(
                     bx, dof_field(lev).array(mfi), fluxC(lev).array(mfi));
             }
 
+            const int state = narrow_band ? box_states[lev][mfi.LocalIndex()]
+                                          : box_interface;
+            if (state != box_interface) {
+                // Fluxes are still needed by the neighboring boxes and the
+                // coarser levels
+                multiphase::split_uniform_fluxes(
+                    lev, bx, isweep + iorder, (state == box_full) ? 1.0 : 0.0,
+                    u_mac(lev).const_array(mfi), v_mac(lev).const_array(mfi),
+                    w_mac(lev).const_array(mfi), (*advas[lev][0]).array(mfi),
+                    (*advas[lev][1]).array(mfi), (*advas[lev][2]).array(mfi),
+                    (*fluxes[lev][0]).array(mfi), (*fluxes[lev][1]).array(mfi),
+                    (*fluxes[lev][2]).array(mfi), BCs, geom, dt);
+                continue;
+            }
+
+            amrex::FArrayBox tmpfab(
+                amrex::grow(bx, 1), 2, amrex::The_Async_Arena());
+            tmpfab.setVal<amrex::RunOn::Device>(0.0);
+
             // Calculate fluxes involved in this stage of split advection
             multiphase::split_compute_fluxes(
                 lev, bx, isweep + iorder, dof_field(lev).const_array(mfi),
@@ -81,6 +152,12 @@ void multiphase::split_advection_step(
 #endif
         for (amrex::MFIter mfi(dof_field(lev), mfi_info); mfi.isValid();
              ++mfi) {
+            // Empty and full cells are unchanged by the sweep
+            if (narrow_band &&
+                box_states[lev][mfi.LocalIndex()] != box_interface) {
+                continue;
+            }
+
             const auto& bx = mfi.tilebox();
             // Sum fluxes from this stage of advection
             multiphase::split_compute_sum(
@@ -169,6 +246,43 @@ void multiphase::split_compute_fluxes(
     }
 }
 
+void multiphase::split_uniform_fluxes(
+    const int lev,
+    amrex::Box const& bx,
+    const int isweep,
+    const amrex::Real vof,
+    amrex::Array4<amrex::Real const> const& umac,
+    amrex::Array4<amrex::Real const> const& vmac,
+    amrex::Array4<amrex::Real const> const& wmac,
+    amrex::Array4<amrex::Real> const& aax,
+    amrex::Array4<amrex::Real> const& aay,
+    amrex::Array4<amrex::Real> const& aaz,
+    amrex::Array4<amrex::Real> const& fx,
+    amrex::Array4<amrex::Real> const& fy,
+    amrex::Array4<amrex::Real> const& fz,
+    amrex::GpuArray<BC, AMREX_SPACEDIM * 2> BCs,
+    amrex::Vector<amrex::Geometry> geom,
+    const amrex::Real dt)
+{
+    BL_PROFILE("amr-wind::multiphase::split_uniform_fluxes");
+
+    const int dir = (isweep % 3 == 0) ? 2 : ((isweep % 3 == 1) ? 1 : 0);
+    const auto& vel_mac = (dir == 0) ? umac : ((dir == 1) ? vmac : wmac);
+    const auto& advalpha_f = (dir == 0) ? aax : ((dir == 1) ? aay : aaz);
+    const auto& f_f = (dir == 0) ? fx : ((dir == 1) ? fy : fz);
+
+    Box const& domain = geom[lev].Domain();
+    const int domlo = domain.smallEnd(dir);
+    const int domhi = domain.bigEnd(dir);
+
+    Box const& fbx = amrex::surroundingNodes(bx, dir);
+    amrex::ParallelFor(fbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        uniform_fluxes_bc_save(
+            i, j, k, dir, dt * vel_mac(i, j, k), vof, f_f, advalpha_f, BCs,
+            domlo, domhi);
+    });
+}
+
 void multiphase::split_compute_sum(
     const int lev,
     amrex::Box const& bx,
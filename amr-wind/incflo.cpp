@@ -3,10 +3,13 @@
 #include "amr-wind/wind_energy/ABL.H"
 #include "amr-wind/utilities/tagging/RefinementCriteria.H"
 #include "amr-wind/equation_systems/PDEBase.H"
+#include "amr-wind/equation_systems/ScalarDiffusionBatch.H"
+#include "amr-wind/equation_systems/ScalarAdvectionBatch.H"
 #include "amr-wind/turbulence/TurbulenceModel.H"
 #include "amr-wind/equation_systems/SchemeTraits.H"
 #include "amr-wind/utilities/IOManager.H"
 #include "amr-wind/utilities/PostProcessing.H"
+#include "amr-wind/utilities/PerfLog.H"
 #include "amr-wind/overset/OversetManager.H"
 
 #include "AMReX_ParmParse.H"
@@ -185,6 +188,7 @@ void incflo::InitData()
 bool incflo::regrid_and_update()
 {
     BL_PROFILE("amr-wind::incflo::regrid_and_update");
+    amr_wind::PerfLog::Timer timer(amr_wind::PerfLog::Regrid);
 
     if (m_time.do_regrid()) {
         amrex::Print() << "Regrid mesh ... ";
@@ -222,6 +226,14 @@ bool incflo::regrid_and_update()
 
         m_sim.pde_manager().fillpatch_state_fields(m_time.current_time());
 
+        // Nodal projector is rebuilt on the new grids at the next projection
+        m_nodal_proj.reset();
+        m_nodal_proj_p_hist.clear();
+        m_nodal_proj_p_time.clear();
+        if (m_scalar_diff_batch) {
+            m_scalar_diff_batch->post_regrid_actions();
+        }
+
         icns().post_regrid_actions();
         for (auto& eqn : scalar_eqns()) {
             eqn->post_regrid_actions();
@@ -285,8 +297,14 @@ void incflo::Evolve()
 
     const amrex::Real init_time = amrex::ParallelDescriptor::second();
 
+    if (m_perf_log) {
+        amr_wind::PerfLog::initialize(
+            m_sim.io_manager().post_processing_directory());
+    }
+
     while (m_time.new_timestep()) {
         const amrex::Real time0 = amrex::ParallelDescriptor::second();
+        amr_wind::PerfLog::begin_step();
 
         regrid_and_update();
 
@@ -312,6 +330,8 @@ void incflo::Evolve()
         const amrex::Real time2 = amrex::ParallelDescriptor::second();
         post_advance_work();
         const amrex::Real time3 = amrex::ParallelDescriptor::second();
+        amr_wind::PerfLog::end_step(
+            m_time.time_index(), m_time.new_time(), m_time.delta_t());
 
         amrex::Print() << "WallClockTime in Evolve() for step "
                        << m_time.time_index()
@@ -331,6 +351,16 @@ void incflo::Evolve()
         }
 #endif
     }
+    amr_wind::PerfLog::finalize();
+    if (const auto* pool = m_sim.repo().scratch_pool()) {
+        pool->print_stats();
+    }
+    if (m_nodal_proj_warm_start && (m_nodal_proj_num_solves > 0)) {
+        amrex::Print() << "Warm-started nodal projections: "
+                       << m_nodal_proj_num_solves << " solves, "
+                       << m_nodal_proj_num_iters << " MLMG iterations"
+                       << std::endl;
+    }
     amrex::Print() << "\n======================================================"
                       "========================\n"
                    << std::endl;
@@ -343,6 +373,7 @@ void incflo::Evolve()
         m_sim.io_manager().write_checkpoint_file();
     }
     m_sim.post_manager().final_output();
+    m_sim.io_manager().wait_for_output();
 }
 
 void incflo::do_advance(const int fixed_point_iteration)
@@ -414,6 +445,24 @@ void incflo::init_physics_and_pde()
             m_sim.activate_overset();
         }
 
+        bool use_scratch_pool = false;
+        pp.query("use_scratch_field_pool", use_scratch_pool);
+        m_sim.repo().enable_scratch_pool(use_scratch_pool);
+
+        bool batch_scalar_diffusion = false;
+        pp.query("batch_scalar_diffusion", batch_scalar_diffusion);
+        if (batch_scalar_diffusion) {
+            m_scalar_diff_batch =
+                std::make_unique<amr_wind::pde::ScalarDiffusionBatch>(m_repo);
+        }
+
+        bool batch_scalar_advection = false;
+        pp.query("batch_scalar_advection", batch_scalar_advection);
+        if (batch_scalar_advection) {
+            m_scalar_adv_batch =
+                std::make_unique<amr_wind::pde::ScalarAdvectionBatch>(m_repo);
+        }
+
         pp.query("fixed_point_iterations", m_fixed_point_iterations);
         AMREX_ALWAYS_ASSERT_WITH_MESSAGE(
             m_fixed_point_iterations > 0,
@@ -2,8 +2,11 @@
 
 #include "amr-wind/incflo.H"
 #include "amr-wind/core/Physics.H"
+#include "amr-wind/core/FieldGroup.H"
 #include "amr-wind/core/field_ops.H"
 #include "amr-wind/equation_systems/PDEBase.H"
+#include "amr-wind/equation_systems/ScalarDiffusionBatch.H"
+#include "amr-wind/equation_systems/ScalarAdvectionBatch.H"
 #include "amr-wind/turbulence/TurbulenceModel.H"
 #include "amr-wind/utilities/console_io.H"
 #include "amr-wind/utilities/PostProcessing.H"
@@ -281,11 +284,13 @@ void incflo::ApplyPredictor(
 
         const int nghost_force = 1;
         IntVect ng(nghost_force);
-        icns().fields().src_term.fillpatch(m_time.current_time(), ng);
+        amr_wind::FieldGroup group;
+        group.add(icns().fields().src_term, ng);
 
         for (auto& eqn : scalar_eqns()) {
-            eqn->fields().src_term.fillpatch(m_time.current_time(), ng);
+            group.add(eqn->fields().src_term, ng);
         }
+        group.fillpatch(m_time.current_time());
     }
 
     // Extrapolate and apply MAC projection for advection velocities
@@ -305,10 +310,24 @@ void incflo::ApplyPredictor(
     // corrector too.
     // Perform scalar update one at a time. This is to allow an
     // updated density at `n+1/2` to be computed before other scalars use it
-    // when computing their source terms.
-    for (auto& eqn : scalar_eqns()) {
+    // when computing their source terms. Consecutive scalars with batched
+    // diffusion solves are only solved before the next unbatched scalar.
+    // Consecutive scalars with batched advection are advected together.
+    amrex::Vector<amr_wind::pde::PDEBase*> batched_eqns;
+    const int nscalars = static_cast<int>(scalar_eqns().size());
+    int nadvected = 0;
+    for (int ieqn = 0; ieqn < nscalars; ++ieqn) {
+        auto& eqn = scalar_eqns()[ieqn];
+        const bool batched = use_batched_diffusion(*eqn);
+        if (!batched) {
+            solve_batched_diffusion(batched_eqns);
+        }
+
         // Compute explicit advection
-        eqn->compute_advection_term(amr_wind::FieldState::Old);
+        if (ieqn >= nadvected) {
+            nadvected = ieqn + compute_scalar_advection(
+                                   ieqn, amr_wind::FieldState::Old);
+        }
 
         // Compute (recompute for Godunov) the scalar forcing terms
         eqn->compute_source_term(amr_wind::FieldState::NPH);
@@ -316,6 +335,11 @@ void incflo::ApplyPredictor(
         // Update the scalar (if explicit), or the RHS for implicit/CN
         eqn->compute_predictor_rhs(m_diff_type);
 
+        if (batched) {
+            batched_eqns.push_back(eqn.get());
+            continue;
+        }
+
         auto& field = eqn->fields().field;
         if (m_diff_type != DiffusionType::Explicit) {
             amrex::Real dt_diff = (m_diff_type == DiffusionType::Implicit)
@@ -345,6 +369,7 @@ void incflo::ApplyPredictor(
             field.state(amr_wind::FieldState::Old), 0, 0.5, field, 0, 0,
             field.num_comp(), 1);
     }
+    solve_batched_diffusion(batched_eqns);
 
     // With scalars computed, compute advection of momentum
     const auto fstate = (fixed_point_iteration == 0)
@@ -577,7 +602,13 @@ void incflo::ApplyCorrector()
     // corrector too Perform scalar update one at a time. This is to allow an
     // updated density at `n+1/2` to be computed before other scalars use it
     // when computing their source terms.
+    amrex::Vector<amr_wind::pde::PDEBase*> batched_eqns;
     for (auto& eqn : scalar_eqns()) {
+        const bool batched = use_batched_diffusion(*eqn);
+        if (!batched) {
+            solve_batched_diffusion(batched_eqns);
+        }
+
         // Compute (recompute for Godunov) the scalar forcing terms
         // Note this is (rho * scalar) and not just scalar
         eqn->compute_source_term(amr_wind::FieldState::New);
@@ -587,6 +618,11 @@ void incflo::ApplyCorrector()
         //                   div(rho trac u) + div (mu grad trac) + rho * f_t
         eqn->compute_corrector_rhs(m_diff_type);
 
+        if (batched) {
+            batched_eqns.push_back(eqn.get());
+            continue;
+        }
+
         auto& field = eqn->fields().field;
         if (m_diff_type != DiffusionType::Explicit) {
             amrex::Real dt_diff = (m_diff_type == DiffusionType::Implicit)
@@ -604,6 +640,7 @@ void incflo::ApplyCorrector()
             field.state(amr_wind::FieldState::Old), 0, 0.5, field, 0, 0,
             field.num_comp(), 1);
     }
+    solve_batched_diffusion(batched_eqns);
 
     // *************************************************************************************
     // Define the forcing terms to use in the final update (using half-time
@@ -701,9 +738,11 @@ void incflo::ApplyPrescribeStep()
     if (m_use_godunov) {
         const int nghost_force = 1;
         IntVect ng(nghost_force);
+        amr_wind::FieldGroup group;
         for (auto& eqn : scalar_eqns()) {
-            eqn->fields().src_term.fillpatch(m_time.current_time(), ng);
+            group.add(eqn->fields().src_term, ng);
         }
+        group.fillpatch(m_time.current_time());
     }
 
     // For scalars only first
@@ -713,8 +752,9 @@ void incflo::ApplyPrescribeStep()
     // if (!m_use_godunov) Compute the explicit advective terms
     //                     R_u^n      , R_s^n       and R_t^n
     // *************************************************************************************
-    for (auto& seqn : scalar_eqns()) {
-        seqn->compute_advection_term(amr_wind::FieldState::Old);
+    const int nscalars = static_cast<int>(scalar_eqns().size());
+    for (int ieqn = 0; ieqn < nscalars;) {
+        ieqn += compute_scalar_advection(ieqn, amr_wind::FieldState::Old);
     }
 
     // *************************************************************************************
@@ -724,13 +764,24 @@ void incflo::ApplyPrescribeStep()
         amr_wind::field_ops::copy(density_nph, density_old, 0, 0, 1, 1);
     }
 
+    amrex::Vector<amr_wind::pde::PDEBase*> batched_eqns;
     for (auto& eqn : scalar_eqns()) {
+        const bool batched = use_batched_diffusion(*eqn);
+        if (!batched) {
+            solve_batched_diffusion(batched_eqns);
+        }
+
         // Compute (recompute for Godunov) the scalar forcing terms
         eqn->compute_source_term(amr_wind::FieldState::NPH);
 
         // Update the scalar (if explicit), or the RHS for implicit/CN
         eqn->compute_predictor_rhs(m_diff_type);
 
+        if (batched) {
+            batched_eqns.push_back(eqn.get());
+            continue;
+        }
+
         auto& field = eqn->fields().field;
         if (m_diff_type != DiffusionType::Explicit) {
             amrex::Real dt_diff = (m_diff_type == DiffusionType::Implicit)
@@ -749,6 +800,7 @@ void incflo::ApplyPrescribeStep()
             field.state(amr_wind::FieldState::Old), 0, 0.5, field, 0, 0,
             field.num_comp(), 1);
     }
+    solve_batched_diffusion(batched_eqns);
 
     // With scalars computed, compute advection of momentum
     icns().compute_advection_term(amr_wind::FieldState::Old);
@@ -759,3 +811,64 @@ void incflo::ApplyPrescribeStep()
 
     icns().post_solve_actions();
 }
+
+int incflo::compute_scalar_advection(
+    const int ieqn, const amr_wind::FieldState fstate)
+{
+    amrex::Vector<amr_wind::pde::PDEBase*> eqns;
+    if (m_scalar_adv_batch) {
+        const int nscalars = static_cast<int>(scalar_eqns().size());
+        for (int i = ieqn; i < nscalars; ++i) {
+            auto& eqn = scalar_eqns()[i];
+            if (!eqn->supports_batched_advection()) {
+                break;
+            }
+            eqns.push_back(eqn.get());
+        }
+    }
+
+    if (eqns.size() < 2) {
+        scalar_eqns()[ieqn]->compute_advection_term(fstate);
+        return 1;
+    }
+
+    m_scalar_adv_batch->compute(eqns, fstate, m_time.delta_t());
+    return static_cast<int>(eqns.size());
+}
+
+bool incflo::use_batched_diffusion(const amr_wind::pde::PDEBase& eqn) const
+{
+    return m_scalar_diff_batch && (m_diff_type != DiffusionType::Explicit) &&
+           eqn.supports_batched_diffusion();
+}
+
+void incflo::solve_batched_diffusion(
+    amrex::Vector<amr_wind::pde::PDEBase*>& eqns)
+{
+    if (eqns.empty()) {
+        return;
+    }
+
+    BL_PROFILE("amr-wind::incflo::solve_batched_diffusion");
+    const amrex::Real dt_diff = (m_diff_type == DiffusionType::Implicit)
+                                    ? m_time.delta_t()
+                                    : 0.5 * m_time.delta_t();
+    if (eqns.size() == 1) {
+        eqns[0]->solve(dt_diff);
+    } else {
+        m_scalar_diff_batch->solve(eqns, dt_diff);
+    }
+
+    for (auto* eqn : eqns) {
+        // Post-processing actions after a PDE solve
+        eqn->post_solve_actions();
+
+        // Update scalar at n+1/2
+        auto& field = eqn->fields().field;
+        amr_wind::field_ops::lincomb(
+            field.state(amr_wind::FieldState::NPH), 0.5,
+            field.state(amr_wind::FieldState::Old), 0, 0.5, field, 0, 0,
+            field.num_comp(), 1);
+    }
+    eqns.clear();
+}
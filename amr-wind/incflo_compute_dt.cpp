@@ -1,5 +1,6 @@
 #include "amr-wind/incflo.H"
 #include "amr-wind/equation_systems/vof/volume_fractions.H"
+#include "amr-wind/utilities/ReductionBatch.H"
 
 #include <cmath>
 #include <limits>
@@ -35,9 +36,8 @@ void incflo::compute_dt()
 
     bool explicit_diffusion = (m_diff_type == DiffusionType::Explicit);
 
-    Real conv_cfl = 0.0;
-    Real diff_cfl = 0.0;
-    Real force_cfl = 0.0;
+    const bool use_force_cfl = m_time.use_force_cfl();
+    const bool has_vof = m_sim.pde_manager().has_pde("VOF");
     const bool mesh_mapping = m_sim.has_mesh_mapping();
 
     const auto& den = density();
@@ -47,6 +47,13 @@ void incflo::compute_dt()
             : nullptr;
     const auto& mask_cell = m_repo.get_int_field("mask_cell");
 
+    // The convective, diffusive, and forcing limits are computed in a single
+    // sweep over each level and reduced across processes together
+    amr_wind::ReductionBatch cfl;
+    cfl.max("convective", 0.0);
+    cfl.max("diffusive", 0.0);
+    cfl.max("forcing", 0.0);
+
     for (int lev = 0; lev <= finest_level; ++lev) {
         auto const dxinv = geom[lev].InvCellSizeArray();
         MultiFab const& vel = icns().fields().field(lev);
@@ -55,20 +62,22 @@ void incflo::compute_dt()
         MultiFab const& rho = den(lev);
 
         auto const& vel_arr = vel.const_arrays();
+        auto const& vf_arr = vel_force.const_arrays();
+        auto const& mu_arr = mu.const_arrays();
+        auto const& rho_arr = rho.const_arrays();
         auto const& mask_arr = mask_cell(lev).const_arrays();
         MultiArray4<Real const> fac_arr =
             mesh_mapping ? ((*mesh_fac)(lev).const_arrays())
                          : MultiArray4<Real const>();
-
-        Real conv_lev = 0.0;
-        Real mphase_conv_lev = 0.0;
-        Real diff_lev = 0.0;
-        Real force_lev = 0.0;
-
-        conv_lev += amrex::ParReduce(
-            TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel, IntVect(0),
-            [=] AMREX_GPU_DEVICE(
-                int box_no, int i, int j, int k) -> GpuTuple<Real> {
+        MultiArray4<Real const> vof_arr =
+            has_vof ? (m_repo.get_field("vof")(lev).const_arrays())
+                    : MultiArray4<Real const>();
+
+        const auto cfl_lev = amrex::ParReduce(
+            TypeList<ReduceOpMax, ReduceOpMax, ReduceOpMax>{},
+            TypeList<Real, Real, Real>{}, vel, IntVect(0),
+            [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k)
+                -> GpuTuple<Real, Real, Real> {
                 auto const& v_bx = vel_arr[box_no];
 
                 const amrex::Real fac_x =
@@ -81,133 +90,62 @@ void incflo::compute_dt()
                 const auto mask =
                     static_cast<amrex::Real>(mask_arr[box_no](i, j, k));
 
-                return amrex::max<amrex::Real>(
+                amrex::Real conv = amrex::max<amrex::Real>(
                     mask * std::abs(v_bx(i, j, k, 0)) * dxinv[0] / fac_x,
                     mask * std::abs(v_bx(i, j, k, 1)) * dxinv[1] / fac_y,
                     mask * std::abs(v_bx(i, j, k, 2)) * dxinv[2] / fac_z,
                     static_cast<amrex::Real>(-1.0));
-            });
-
-        if (m_sim.pde_manager().has_pde("VOF")) {
-            MultiFab const& vof = m_repo.get_field("vof")(lev);
-            auto const& vof_arr = vof.const_arrays();
-            mphase_conv_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel, IntVect(0),
-                [=] AMREX_GPU_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                    auto const& v_bx = vel_arr[box_no];
-                    auto const& vof_bx = vof_arr[box_no];
-
-                    // Check for interface
-                    auto is_near =
-                        amr_wind::multiphase::interface_band(i, j, k, vof_bx);
-
-                    // CFL calculation is not needed away from interface
-                    amrex::Real result = 0.0;
-                    if (is_near) {
-                        // Near interface, evaluate CFL by sum of velocities
-                        const amrex::Real fac_x =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                        const amrex::Real fac_y =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                        const amrex::Real fac_z =
-                            mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
-                        result = std::abs(v_bx(i, j, k, 0)) * dxinv[0] / fac_x +
-                                 std::abs(v_bx(i, j, k, 1)) * dxinv[1] / fac_y +
-                                 std::abs(v_bx(i, j, k, 2)) * dxinv[2] / fac_z;
-
-                        const auto mask =
-                            static_cast<amrex::Real>(mask_arr[box_no](i, j, k));
-
-                        // Multiply advective CFL by 2 when near interface
-                        result *= 2.0 * mask;
-                        // CFL requirement to ensure vof conservation is 0.5;
-                        // this is half the typical concept of a CFL (1.0)
-                    }
-                    return result;
-                });
-        }
-        conv_lev = amrex::max(conv_lev, mphase_conv_lev);
-
-        if (explicit_diffusion) {
-            auto const& mu_arr = mu.const_arrays();
-            auto const& rho_arr = rho.const_arrays();
-            diff_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, rho, IntVect(0),
-                [=] AMREX_GPU_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
-                    auto const& mu_bx = mu_arr[box_no];
-                    auto const& rho_bx = rho_arr[box_no];
-
-                    const amrex::Real fac_x =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                    const amrex::Real fac_y =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                    const amrex::Real fac_z =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
 
+                // Check for interface
+                if (has_vof && amr_wind::multiphase::interface_band(
+                                   i, j, k, vof_arr[box_no])) {
+                    // Near interface, evaluate CFL by sum of velocities
+                    // Multiply advective CFL by 2 when near interface
+                    // CFL requirement to ensure vof conservation is 0.5;
+                    // this is half the typical concept of a CFL (1.0)
+                    conv = amrex::max(
+                        conv,
+                        2.0 * mask *
+                            (std::abs(v_bx(i, j, k, 0)) * dxinv[0] / fac_x +
+                             std::abs(v_bx(i, j, k, 1)) * dxinv[1] / fac_y +
+                             std::abs(v_bx(i, j, k, 2)) * dxinv[2] / fac_z));
+                }
+
+                amrex::Real diff = 0.0;
+                if (explicit_diffusion) {
                     const Real dxinv2 =
                         2.0 * (dxinv[0] / fac_x * dxinv[0] / fac_x +
                                dxinv[1] / fac_y * dxinv[1] / fac_y +
                                dxinv[2] / fac_z * dxinv[2] / fac_z);
 
-                    const auto mask =
-                        static_cast<amrex::Real>(mask_arr[box_no](i, j, k));
+                    diff = mask * mu_arr[box_no](i, j, k) * dxinv2 /
+                           rho_arr[box_no](i, j, k);
+                }
 
-                    return amrex::max<amrex::Real>(
-                        mask * mu_bx(i, j, k) * dxinv2 / rho_bx(i, j, k), -1.0);
-                });
-        }
-
-        if (m_time.use_force_cfl()) {
-            auto const& vf_arr = vel_force.const_arrays();
-            auto const& rho_arr = rho.const_arrays();
-            force_lev += amrex::ParReduce(
-                TypeList<ReduceOpMax>{}, TypeList<Real>{}, vel_force,
-                IntVect(0),
-                [=] AMREX_GPU_DEVICE(
-                    int box_no, int i, int j, int k) -> GpuTuple<Real> {
+                amrex::Real force = 0.0;
+                if (use_force_cfl) {
                     auto const& vf_bx = vf_arr[box_no];
                     auto const& rho_bx = rho_arr[box_no];
-
-                    const amrex::Real fac_x =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 0)) : 1.0;
-                    const amrex::Real fac_y =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 1)) : 1.0;
-                    const amrex::Real fac_z =
-                        mesh_mapping ? (fac_arr[box_no](i, j, k, 2)) : 1.0;
-
-                    const auto mask =
-                        static_cast<amrex::Real>(mask_arr[box_no](i, j, k));
-
-                    return amrex::max<amrex::Real>(
+                    force = amrex::max<amrex::Real>(
                         mask * std::abs(vf_bx(i, j, k, 0)) * dxinv[0] / fac_x /
                             rho_bx(i, j, k),
                         mask * std::abs(vf_bx(i, j, k, 1)) * dxinv[1] / fac_y /
                             rho_bx(i, j, k),
                         mask * std::abs(vf_bx(i, j, k, 2)) * dxinv[2] / fac_z /
-                            rho_bx(i, j, k),
-                        static_cast<amrex::Real>(-1.0));
-                });
-        }
+                            rho_bx(i, j, k));
+                }
 
-        conv_cfl = amrex::max(conv_cfl, conv_lev);
-        diff_cfl = amrex::max(diff_cfl, diff_lev);
-        force_cfl = amrex::max(force_cfl, force_lev);
-    }
+                return {conv, diff, force};
+            });
 
-    ParallelAllReduce::Max<Real>(conv_cfl, ParallelContext::CommunicatorSub());
-    if (explicit_diffusion) {
-        ParallelAllReduce::Max<Real>(
-            diff_cfl, ParallelContext::CommunicatorSub());
-    }
-    if (m_time.use_force_cfl()) {
-        ParallelAllReduce::Max<Real>(
-            force_cfl, ParallelContext::CommunicatorSub());
+        cfl.max("convective", amrex::get<0>(cfl_lev));
+        cfl.max("diffusive", amrex::get<1>(cfl_lev));
+        cfl.max("forcing", amrex::get<2>(cfl_lev));
     }
 
-    m_time.set_current_cfl(conv_cfl, diff_cfl, force_cfl);
+    cfl.reduce();
+    m_time.set_current_cfl(
+        cfl.value("convective"), cfl.value("diffusive"), cfl.value("forcing"));
 }
 
 void incflo::compute_prescribe_dt()
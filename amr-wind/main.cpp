@@ -50,6 +50,23 @@ int main(int argc, char* argv[])
         if (!pp.contains("signal_handling")) {
             pp.add("signal_handling", 0);
         }
+
+        // Asynchronous plot and checkpoint output relies on AMReX AsyncOut.
+        // Unless specified by the user, every rank writes its own file so
+        // that the background writes do not require MPI_THREAD_MULTIPLE.
+        amrex::ParmParse pp_io("io");
+        bool async_output = false;
+        pp_io.query("async_output", async_output);
+        if (async_output && !pp.contains("async_out")) {
+            pp.add("async_out", 1);
+#ifdef AMREX_USE_MPI
+            if (!pp.contains("async_out_nfiles")) {
+                int nprocs = 1;
+                MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+                pp.add("async_out_nfiles", nprocs);
+            }
+#endif
+        }
     });
 
     { /* These braces are necessary to ensure amrex::Finalize() can be called
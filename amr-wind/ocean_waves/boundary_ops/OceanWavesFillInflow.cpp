@@ -34,6 +34,25 @@ void OceanWavesFillInflow::fillpatch(
     }
 }
 
+void OceanWavesFillInflow::fillpatch_end(
+    int lev,
+    amrex::Real time,
+    amrex::MultiFab& mfab,
+    const amrex::IntVect& nghost,
+    const FieldState fstate)
+{
+    FieldFillPatchOps<FieldBCDirichlet>::fillpatch_end(
+        lev, time, mfab, nghost, fstate);
+
+    if (m_field.base_name() == "velocity") {
+        m_ow_bndry.set_velocity(lev, time, m_field, mfab);
+    } else if (m_field.base_name() == "vof") {
+        m_ow_bndry.set_vof(lev, time, m_field, mfab);
+    } else if (m_field.base_name() == "density") {
+        m_ow_bndry.set_density(lev, time, m_field, mfab);
+    }
+}
+
 void OceanWavesFillInflow::fillpatch_from_coarse(
     int lev,
     amrex::Real time,
@@ -22,6 +22,7 @@ void OversetOps::initialize(CFDSim& sim)
     pp.query("reinit_rlscale", m_relative_length_scale);
     pp.query("reinit_upw_margin", m_upw_margin);
     pp.query("reinit_target_cutoff", m_target_cutoff);
+    pp.query("reinit_narrow_band", m_narrow_band);
 
     // Queries for coupling options
     pp.query("replace_gradp_postsolve", m_replace_gradp_postsolve);
@@ -183,6 +184,8 @@ void OversetOps::parameter_output() const
             amrex::Print() << "---- Calc. conv. interval : "
                            << m_calc_convg_interval << std::endl
                            << "---- Target field cutoff  : " << m_target_cutoff
+                           << std::endl
+                           << "---- Narrow band          : " << m_narrow_band
                            << std::endl;
         }
         amrex::Print() << std::endl;
@@ -274,6 +277,18 @@ void OversetOps::sharpen_nalu_data()
         fluxes[lev][2] = &(*flux_z)(lev);
     }
 
+    // Boxes where the iterations can modify the fields (all if empty)
+    amrex::Vector<amrex::Vector<int>> active(nlevels);
+    if (m_narrow_band) {
+        active = sharpen_active_boxes(*target_vof);
+        // Fluxes of inactive boxes are zero and get averaged down as such
+        for (int lev = 0; lev < nlevels; ++lev) {
+            (*flux_x)(lev).setVal(0.0);
+            (*flux_y)(lev).setVal(0.0);
+            (*flux_z)(lev).setVal(0.0);
+        }
+    }
+
     // Pseudo-time loop
     amrex::Real err = 100.0 * m_convg_tol;
     int n = 0;
@@ -291,26 +306,27 @@ void OversetOps::sharpen_nalu_data()
         for (int lev = 0; lev < nlevels; ++lev) {
             // Populate normal vector
             overset_ops::populate_normal_vector(
-                (*normal_vec)(lev), vof(lev), iblank_cell(lev));
+                (*normal_vec)(lev), vof(lev), iblank_cell(lev), active[lev]);
 
             // Sharpening fluxes for vof, density, and momentum
             overset_ops::populate_sharpen_fluxes(
                 (*flux_x)(lev), (*flux_y)(lev), (*flux_z)(lev), vof(lev),
                 (*target_vof)(lev), (*normal_vec)(lev), velocity(lev), gp(lev),
                 rho(lev), pvscale, m_upw_margin, m_mphase->rho1(),
-                m_mphase->rho2());
+                m_mphase->rho2(), active[lev]);
 
             // Process fluxes
             overset_ops::process_fluxes_calc_src(
                 (*flux_x)(lev), (*flux_y)(lev), (*flux_z)(lev), (*p_src)(lev),
-                vof(lev), iblank_cell(lev));
+                vof(lev), iblank_cell(lev), active[lev]);
 
             // Measure convergence to determine if loop can stop
             if (calc_convg) {
                 // Update error at specified interval of steps
                 const amrex::Real err_lev =
                     overset_ops::measure_convergence(
-                        (*flux_x)(lev), (*flux_y)(lev), (*flux_z)(lev)) /
+                        (*flux_x)(lev), (*flux_y)(lev), (*flux_z)(lev),
+                        active[lev]) /
                     pvscale;
                 err = amrex::max(err, err_lev);
             }
@@ -331,11 +347,17 @@ void OversetOps::sharpen_nalu_data()
             // Convergence tolerance determines what size of fluxes matter
             const amrex::Real ptfac_lev = overset_ops::calculate_pseudo_dt_flux(
                 (*flux_x)(lev), (*flux_y)(lev), (*flux_z)(lev), vof(lev), dx,
-                m_convg_tol);
+                m_convg_tol, active[lev]);
             ptfac = amrex::min(ptfac, ptfac_lev);
         }
         amrex::Gpu::streamSynchronize();
-        amrex::ParallelDescriptor::ReduceRealMin(ptfac);
+
+        // Single reduction for pseudo dt and error; the error is unchanged
+        // across processors when it is not calculated this step
+        amrex::Real reduce_vals[2] = {-ptfac, err};
+        amrex::ParallelDescriptor::ReduceRealMax(reduce_vals, 2);
+        ptfac = -reduce_vals[0];
+        err = reduce_vals[1];
 
         // Conform pseudo dt (dtau) to pseudo CFL
         ptfac = pCFL * ptfac;
@@ -347,7 +369,7 @@ void OversetOps::sharpen_nalu_data()
             overset_ops::apply_fluxes(
                 (*flux_x)(lev), (*flux_y)(lev), (*flux_z)(lev), (*p_src)(lev),
                 vof(lev), rho(lev), velocity(lev), gp(lev), p(lev), dx, ptfac,
-                m_vof_tol);
+                m_vof_tol, active[lev]);
 
             vof(lev).FillBoundary(geom[lev].periodicity());
             velocity(lev).FillBoundary(geom[lev].periodicity());
@@ -358,11 +380,6 @@ void OversetOps::sharpen_nalu_data()
         // Update density (fillpatch built in)
         m_mphase->set_density_via_vof();
 
-        // Ensure that err is same across processors
-        if (calc_convg) {
-            amrex::ParallelDescriptor::ReduceRealMax(err);
-        }
-
         if (m_verbose > 0) {
             amrex::Print() << "OversetOps: sharpen step " << n << "  conv. err "
                            << err << "  tol " << m_convg_tol << std::endl;
@@ -381,6 +398,89 @@ void OversetOps::sharpen_nalu_data()
     amrex::Gpu::streamSynchronize();
 }
 
+amrex::Vector<amrex::Vector<int>>
+OversetOps::sharpen_active_boxes(const ScratchField& target_vof) const
+{
+    BL_PROFILE("amr-wind::OversetOps::sharpen_active_boxes");
+    const auto& repo = m_sim_ptr->repo();
+    const auto& mesh = m_sim_ptr->mesh();
+    const auto nlevels = repo.num_active_levels();
+    const auto& iblank_cell = repo.get_int_field("iblank_cell");
+    const auto& vof = repo.get_field("vof");
+
+    // Modified cells grow by at most one cell per iteration, and the
+    // fluxes of a box depend on cells two cells away from it
+    const int margin = m_n_iterations + 2;
+
+    // Gather the flags of the boxes of all levels in a single reduction
+    amrex::Vector<int> offsets(nlevels + 1, 0);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        offsets[lev + 1] =
+            offsets[lev] + static_cast<int>(mesh.boxArray(lev).size());
+    }
+    amrex::Vector<int> flags(offsets[nlevels], 0);
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto local_flags = overset_ops::flag_sharpen_boxes(
+            vof(lev), target_vof(lev), iblank_cell(lev));
+        for (amrex::MFIter mfi(vof(lev)); mfi.isValid(); ++mfi) {
+            flags[offsets[lev] + mfi.index()] = local_flags[mfi.LocalIndex()];
+        }
+    }
+    amrex::ParallelDescriptor::ReduceIntMax(
+        flags.data(), static_cast<int>(flags.size()));
+
+    // Determine the active boxes from the finest level down
+    amrex::Vector<amrex::Vector<int>> active(nlevels);
+    amrex::BoxList fine_active_bl;
+    for (int lev = nlevels - 1; lev >= 0; --lev) {
+        const auto& ba = mesh.boxArray(lev);
+        const auto shifts = mesh.Geom(lev).periodicity().shiftIntVect();
+
+        amrex::BoxList flagged_bl;
+        for (int ib = 0; ib < static_cast<int>(ba.size()); ++ib) {
+            if (flags[offsets[lev] + ib] != 0) {
+                flagged_bl.push_back(ba[ib]);
+            }
+        }
+        const amrex::BoxArray flagged_ba(flagged_bl);
+        const amrex::BoxArray fine_active_ba(fine_active_bl);
+
+        amrex::BoxList active_bl;
+        amrex::Vector<int> is_active(ba.size(), 0);
+        for (int ib = 0; ib < static_cast<int>(ba.size()); ++ib) {
+            const amrex::Box gbx = amrex::grow(ba[ib], margin);
+            for (const auto& iv : shifts) {
+                const amrex::Box sbx = amrex::shift(gbx, iv);
+                if ((!flagged_ba.empty() && flagged_ba.intersects(sbx)) ||
+                    (!fine_active_ba.empty() &&
+                     fine_active_ba.intersects(sbx))) {
+                    is_active[ib] = 1;
+                    active_bl.push_back(ba[ib]);
+                    break;
+                }
+            }
+        }
+
+        auto& lev_active = active[lev];
+        lev_active.assign(vof(lev).local_size(), 0);
+        for (amrex::MFIter mfi(vof(lev)); mfi.isValid(); ++mfi) {
+            lev_active[mfi.LocalIndex()] = is_active[mfi.index()];
+        }
+
+        if (lev > 0) {
+            fine_active_bl = active_bl;
+            fine_active_bl.coarsen(mesh.refRatio(lev - 1));
+        }
+
+        if (m_verbose > 0) {
+            amrex::Print() << "OversetOps: level " << lev << " sharpening "
+                           << active_bl.size() << " of " << ba.size()
+                           << " boxes" << std::endl;
+        }
+    }
+    return active;
+}
+
 void OversetOps::form_perturb_pressure()
 {
     auto& pressure = m_sim_ptr->repo().get_field("p");
@@ -1,4 +1,6 @@
 #include "amr-wind/overset/overset_ops_routines.H"
+#include "AMReX_GpuContainers.H"
+#include "AMReX_Reduce.H"
 
 namespace amr_wind::overset_ops {
 
@@ -220,44 +222,67 @@ void harmonize_vof(
         });
 }
 
-// Populate normal vector with special treatment of overset boundary
-void populate_normal_vector(
-    amrex::MultiFab& mf_normvec,
+// Flag the boxes with cells that reinitialization can modify, i.e., cells
+// within the overset region where vof differs from the target vof
+amrex::Vector<int> flag_sharpen_boxes(
     const amrex::MultiFab& mf_vof,
+    const amrex::MultiFab& mf_target_vof,
     const amrex::iMultiFab& mf_iblank)
 {
-    const auto& normvec = mf_normvec.arrays();
+    amrex::Gpu::DeviceVector<int> d_flags(mf_vof.local_size(), 0);
+    auto* flags = d_flags.data();
     const auto& vof = mf_vof.const_arrays();
+    const auto& tg_vof = mf_target_vof.const_arrays();
     const auto& iblank = mf_iblank.const_arrays();
-    // Calculate gradients in each direction with centered diff
     amrex::ParallelFor(
-        mf_normvec, mf_normvec.n_grow - amrex::IntVect(1),
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            // Neumann condition across nalu bdy
-            int ibdy =
-                (iblank[nbx](i, j, k) != iblank[nbx](i - 1, j, k)) ? -1 : 0;
-            int jbdy =
-                (iblank[nbx](i, j, k) != iblank[nbx](i, j - 1, k)) ? -1 : 0;
-            int kbdy =
-                (iblank[nbx](i, j, k) != iblank[nbx](i, j, k - 1)) ? -1 : 0;
-            // no cell should be isolated such that -1 and 1 are needed
-            ibdy =
-                (iblank[nbx](i, j, k) != iblank[nbx](i + 1, j, k)) ? +1 : ibdy;
-            jbdy =
-                (iblank[nbx](i, j, k) != iblank[nbx](i, j + 1, k)) ? +1 : jbdy;
-            kbdy =
-                (iblank[nbx](i, j, k) != iblank[nbx](i, j, k + 1)) ? +1 : kbdy;
-            // Calculate normal
-            amrex::Real mx, my, mz, mmag;
-            multiphase::youngs_finite_difference_normal_neumann(
-                i, j, k, ibdy, jbdy, kbdy, vof[nbx], mx, my, mz);
-            // Normalize normal
-            mmag = std::sqrt(mx * mx + my * my + mz * mz + 1e-20);
-            // Save normal
-            normvec[nbx](i, j, k, 0) = mx / mmag;
-            normvec[nbx](i, j, k, 1) = my / mmag;
-            normvec[nbx](i, j, k, 2) = mz / mmag;
+        mf_vof, [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+            if (iblank[nbx](i, j, k) == -1 &&
+                vof[nbx](i, j, k) != tg_vof[nbx](i, j, k)) {
+                flags[nbx] = 1;
+            }
         });
+    amrex::Vector<int> h_flags(d_flags.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, d_flags.begin(), d_flags.end(),
+        h_flags.begin());
+    return h_flags;
+}
+
+// Populate normal vector with special treatment of overset boundary
+void populate_normal_vector(
+    amrex::MultiFab& mf_normvec,
+    const amrex::MultiFab& mf_vof,
+    const amrex::iMultiFab& mf_iblank,
+    const amrex::Vector<int>& active_boxes)
+{
+    // Calculate gradients in each direction with centered diff
+    if (active_boxes.empty()) {
+        const auto& normvec = mf_normvec.arrays();
+        const auto& vof = mf_vof.const_arrays();
+        const auto& iblank = mf_iblank.const_arrays();
+        amrex::ParallelFor(
+            mf_normvec, mf_normvec.n_grow - amrex::IntVect(1),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                normal_vector_neumann(
+                    i, j, k, iblank[nbx], vof[nbx], normvec[nbx]);
+            });
+        return;
+    }
+
+    for (amrex::MFIter mfi(mf_normvec); mfi.isValid(); ++mfi) {
+        if (!box_is_active(active_boxes, mfi)) {
+            continue;
+        }
+        const auto& bx =
+            mfi.growntilebox(mf_normvec.nGrowVect() - amrex::IntVect(1));
+        const auto& normvec = mf_normvec.array(mfi);
+        const auto& vof = mf_vof.const_array(mfi);
+        const auto& iblank = mf_iblank.const_array(mfi);
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                normal_vector_neumann(i, j, k, iblank, vof, normvec);
+            });
+    }
 }
 
 // Calculate fluxes for reinitialization over entire domain without concern for
@@ -275,83 +300,80 @@ void populate_sharpen_fluxes(
     const amrex::Real Gamma,
     const amrex::Real margin,
     const amrex::Real rho1,
-    const amrex::Real rho2)
+    const amrex::Real rho2,
+    const amrex::Vector<int>& active_boxes)
 {
-    const auto& fx = mf_fx.arrays();
-    const auto& fy = mf_fy.arrays();
-    const auto& fz = mf_fz.arrays();
-    const auto& vof = mf_vof.const_arrays();
-    const auto& tg_vof = mf_target_vof.const_arrays();
-    const auto& norm = mf_norm.const_arrays();
-    const auto& vel = mf_velocity.const_arrays();
-    const auto& gp = mf_gp.const_arrays();
-    const auto& rho = mf_density.const_arrays();
-    amrex::ParallelFor(
-        mf_fx, mf_fx.n_grow,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            // vof flux
-            amrex::Real flux = Gamma * alpha_flux(
-                                           i, j, k, 0, margin, vof[nbx],
-                                           tg_vof[nbx], norm[nbx]);
-            fx[nbx](i, j, k, 0) = flux;
-            // density flux
-            flux *= (rho1 - rho2);
-            fx[nbx](i, j, k, 1) = flux;
-            // momentum fluxes (dens flux * face vel)
-            amrex::Real uf, vf, wf;
-            velocity_face(i, j, k, 0, vof[nbx], vel[nbx], uf, vf, wf);
-            fx[nbx](i, j, k, 2) = flux * uf;
-            fx[nbx](i, j, k, 3) = flux * vf;
-            fx[nbx](i, j, k, 4) = flux * wf;
-            // pressure gradient fluxes
-            gp_rho_face(i, j, k, 0, vof[nbx], gp[nbx], rho[nbx], uf, vf, wf);
-            fx[nbx](i, j, k, 5) = flux * uf;
-            fx[nbx](i, j, k, 6) = flux * vf;
-            fx[nbx](i, j, k, 7) = flux * wf;
-            // Turn "on" all flux faces, later modified in
-            // process_fluxes_calc_src
-            fx[nbx](i, j, k, 8) = 1.0;
-        });
-    amrex::ParallelFor(
-        mf_fy, mf_fy.n_grow,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            amrex::Real flux = Gamma * alpha_flux(
-                                           i, j, k, 1, margin, vof[nbx],
-                                           tg_vof[nbx], norm[nbx]);
-            fy[nbx](i, j, k, 0) = flux;
-            flux *= (rho1 - rho2);
-            fy[nbx](i, j, k, 1) = flux;
-            amrex::Real uf, vf, wf;
-            velocity_face(i, j, k, 1, vof[nbx], vel[nbx], uf, vf, wf);
-            fy[nbx](i, j, k, 2) = flux * uf;
-            fy[nbx](i, j, k, 3) = flux * vf;
-            fy[nbx](i, j, k, 4) = flux * wf;
-            gp_rho_face(i, j, k, 1, vof[nbx], gp[nbx], rho[nbx], uf, vf, wf);
-            fy[nbx](i, j, k, 5) = flux * uf;
-            fy[nbx](i, j, k, 6) = flux * vf;
-            fy[nbx](i, j, k, 7) = flux * wf;
-            fy[nbx](i, j, k, 8) = 1.0;
-        });
-    amrex::ParallelFor(
-        mf_fz, mf_fz.n_grow,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            amrex::Real flux = Gamma * alpha_flux(
-                                           i, j, k, 2, margin, vof[nbx],
-                                           tg_vof[nbx], norm[nbx]);
-            fz[nbx](i, j, k, 0) = flux;
-            flux *= (rho1 - rho2);
-            fz[nbx](i, j, k, 1) = flux;
-            amrex::Real uf, vf, wf;
-            velocity_face(i, j, k, 2, vof[nbx], vel[nbx], uf, vf, wf);
-            fz[nbx](i, j, k, 2) = flux * uf;
-            fz[nbx](i, j, k, 3) = flux * vf;
-            fz[nbx](i, j, k, 4) = flux * wf;
-            gp_rho_face(i, j, k, 2, vof[nbx], gp[nbx], rho[nbx], uf, vf, wf);
-            fz[nbx](i, j, k, 5) = flux * uf;
-            fz[nbx](i, j, k, 6) = flux * vf;
-            fz[nbx](i, j, k, 7) = flux * wf;
-            fz[nbx](i, j, k, 8) = 1.0;
-        });
+    if (active_boxes.empty()) {
+        const auto& fx = mf_fx.arrays();
+        const auto& fy = mf_fy.arrays();
+        const auto& fz = mf_fz.arrays();
+        const auto& vof = mf_vof.const_arrays();
+        const auto& tg_vof = mf_target_vof.const_arrays();
+        const auto& norm = mf_norm.const_arrays();
+        const auto& vel = mf_velocity.const_arrays();
+        const auto& gp = mf_gp.const_arrays();
+        const auto& rho = mf_density.const_arrays();
+        amrex::ParallelFor(
+            mf_fx, mf_fx.n_grow,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                sharpen_fluxes(
+                    i, j, k, 0, Gamma, margin, rho1, rho2, vof[nbx],
+                    tg_vof[nbx], norm[nbx], vel[nbx], gp[nbx], rho[nbx],
+                    fx[nbx]);
+            });
+        amrex::ParallelFor(
+            mf_fy, mf_fy.n_grow,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                sharpen_fluxes(
+                    i, j, k, 1, Gamma, margin, rho1, rho2, vof[nbx],
+                    tg_vof[nbx], norm[nbx], vel[nbx], gp[nbx], rho[nbx],
+                    fy[nbx]);
+            });
+        amrex::ParallelFor(
+            mf_fz, mf_fz.n_grow,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                sharpen_fluxes(
+                    i, j, k, 2, Gamma, margin, rho1, rho2, vof[nbx],
+                    tg_vof[nbx], norm[nbx], vel[nbx], gp[nbx], rho[nbx],
+                    fz[nbx]);
+            });
+        return;
+    }
+
+    for (amrex::MFIter mfi(mf_vof); mfi.isValid(); ++mfi) {
+        if (!box_is_active(active_boxes, mfi)) {
+            continue;
+        }
+        const auto& xbx = mfi.grownnodaltilebox(0, mf_fx.nGrowVect());
+        const auto& ybx = mfi.grownnodaltilebox(1, mf_fy.nGrowVect());
+        const auto& zbx = mfi.grownnodaltilebox(2, mf_fz.nGrowVect());
+        const auto& fx = mf_fx.array(mfi);
+        const auto& fy = mf_fy.array(mfi);
+        const auto& fz = mf_fz.array(mfi);
+        const auto& vof = mf_vof.const_array(mfi);
+        const auto& tg_vof = mf_target_vof.const_array(mfi);
+        const auto& norm = mf_norm.const_array(mfi);
+        const auto& vel = mf_velocity.const_array(mfi);
+        const auto& gp = mf_gp.const_array(mfi);
+        const auto& rho = mf_density.const_array(mfi);
+        amrex::ParallelFor(
+            xbx, ybx, zbx,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                sharpen_fluxes(
+                    i, j, k, 0, Gamma, margin, rho1, rho2, vof, tg_vof, norm,
+                    vel, gp, rho, fx);
+            },
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                sharpen_fluxes(
+                    i, j, k, 1, Gamma, margin, rho1, rho2, vof, tg_vof, norm,
+                    vel, gp, rho, fy);
+            },
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                sharpen_fluxes(
+                    i, j, k, 2, Gamma, margin, rho1, rho2, vof, tg_vof, norm,
+                    vel, gp, rho, fz);
+            });
+    }
 }
 
 // Process reinitialization fluxes - zero non-internal to overset region;
@@ -362,46 +384,82 @@ void process_fluxes_calc_src(
     amrex::MultiFab& mf_fz,
     amrex::MultiFab& mf_psource,
     const amrex::MultiFab& mf_vof,
-    const amrex::iMultiFab& mf_iblank)
+    const amrex::iMultiFab& mf_iblank,
+    const amrex::Vector<int>& active_boxes)
 {
-    const auto& fx = mf_fx.arrays();
-    const auto& fy = mf_fy.arrays();
-    const auto& fz = mf_fz.arrays();
-    const auto& sp = mf_psource.arrays();
-    const auto& vof = mf_vof.const_arrays();
-    const auto& iblank = mf_iblank.const_arrays();
     constexpr amrex::Real tiny = std::numeric_limits<amrex::Real>::epsilon();
-    // Zero fluxes based on iblank array
-    amrex::ParallelFor(
-        mf_fx, mf_fx.n_grow, mf_fx.n_comp,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
-            const bool zero_all =
-                (iblank[nbx](i - 1, j, k) + iblank[nbx](i, j, k) > -2);
-            fx[nbx](i, j, k, n) *= zero_all ? 0. : 1.;
-        });
-    amrex::ParallelFor(
-        mf_fy, mf_fy.n_grow, mf_fy.n_comp,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
-            const bool zero_all =
-                (iblank[nbx](i, j - 1, k) + iblank[nbx](i, j, k) > -2);
-            fy[nbx](i, j, k, n) *= zero_all ? 0. : 1.;
-        });
-    amrex::ParallelFor(
-        mf_fz, mf_fz.n_grow, mf_fz.n_comp,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
-            const bool zero_all =
-                (iblank[nbx](i, j, k - 1) + iblank[nbx](i, j, k) > -2);
-            fz[nbx](i, j, k, n) *= zero_all ? 0. : 1.;
-        });
-    // With knowledge of fluxes, compute pressure source term
-    amrex::ParallelFor(
-        mf_psource,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            sp[nbx](i, j, k) =
-                gp_flux_tensor(i, j, k, fx[nbx], fy[nbx], fz[nbx], tiny) &&
-                normal_reinit_tensor(
-                    i, j, k, fx[nbx], fy[nbx], fz[nbx], vof[nbx], tiny);
-        });
+    if (active_boxes.empty()) {
+        const auto& fx = mf_fx.arrays();
+        const auto& fy = mf_fy.arrays();
+        const auto& fz = mf_fz.arrays();
+        const auto& sp = mf_psource.arrays();
+        const auto& vof = mf_vof.const_arrays();
+        const auto& iblank = mf_iblank.const_arrays();
+        // Zero fluxes based on iblank array
+        amrex::ParallelFor(
+            mf_fx, mf_fx.n_grow, mf_fx.n_comp,
+            [=] AMREX_GPU_DEVICE(
+                int nbx, int i, int j, int k, int n) noexcept {
+                zero_external_flux(i, j, k, n, 0, iblank[nbx], fx[nbx]);
+            });
+        amrex::ParallelFor(
+            mf_fy, mf_fy.n_grow, mf_fy.n_comp,
+            [=] AMREX_GPU_DEVICE(
+                int nbx, int i, int j, int k, int n) noexcept {
+                zero_external_flux(i, j, k, n, 1, iblank[nbx], fy[nbx]);
+            });
+        amrex::ParallelFor(
+            mf_fz, mf_fz.n_grow, mf_fz.n_comp,
+            [=] AMREX_GPU_DEVICE(
+                int nbx, int i, int j, int k, int n) noexcept {
+                zero_external_flux(i, j, k, n, 2, iblank[nbx], fz[nbx]);
+            });
+        // With knowledge of fluxes, compute pressure source term
+        amrex::ParallelFor(
+            mf_psource,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                sp[nbx](i, j, k) =
+                    gp_flux_tensor(i, j, k, fx[nbx], fy[nbx], fz[nbx], tiny) &&
+                    normal_reinit_tensor(
+                        i, j, k, fx[nbx], fy[nbx], fz[nbx], vof[nbx], tiny);
+            });
+        return;
+    }
+
+    for (amrex::MFIter mfi(mf_vof); mfi.isValid(); ++mfi) {
+        if (!box_is_active(active_boxes, mfi)) {
+            continue;
+        }
+        const auto& xbx = mfi.grownnodaltilebox(0, mf_fx.nGrowVect());
+        const auto& ybx = mfi.grownnodaltilebox(1, mf_fy.nGrowVect());
+        const auto& zbx = mfi.grownnodaltilebox(2, mf_fz.nGrowVect());
+        const auto& ndbx = mfi.nodaltilebox();
+        const auto& fx = mf_fx.array(mfi);
+        const auto& fy = mf_fy.array(mfi);
+        const auto& fz = mf_fz.array(mfi);
+        const auto& sp = mf_psource.array(mfi);
+        const auto& vof = mf_vof.const_array(mfi);
+        const auto& iblank = mf_iblank.const_array(mfi);
+        // Zero fluxes based on iblank array
+        amrex::ParallelFor(
+            xbx, mf_fx.nComp(), ybx, mf_fy.nComp(), zbx, mf_fz.nComp(),
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                zero_external_flux(i, j, k, n, 0, iblank, fx);
+            },
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                zero_external_flux(i, j, k, n, 1, iblank, fy);
+            },
+            [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                zero_external_flux(i, j, k, n, 2, iblank, fz);
+            });
+        // With knowledge of fluxes, compute pressure source term
+        amrex::ParallelFor(
+            ndbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                sp(i, j, k) =
+                    gp_flux_tensor(i, j, k, fx, fy, fz, tiny) &&
+                    normal_reinit_tensor(i, j, k, fx, fy, fz, vof, tiny);
+            });
+    }
 }
 
 amrex::Real calculate_pseudo_velocity_scale(
@@ -422,67 +480,60 @@ amrex::Real calculate_pseudo_dt_flux(
     const amrex::MultiFab& mf_fz,
     const amrex::MultiFab& mf_vof,
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
-    const amrex::Real tol)
+    const amrex::Real tol,
+    const amrex::Vector<int>& active_boxes)
 {
-    // Get the maximum flux magnitude, but just for vof fluxes
-    const amrex::Real pdt_fx = amrex::ReduceMin(
-        mf_fx, mf_vof, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx, amrex::Array4<amrex::Real const> const& fx,
-            amrex::Array4<amrex::Real const> const& vof) -> amrex::Real {
-            amrex::Real pdt_fab = 1.0;
-            amrex::Loop(bx, [=, &pdt_fab](int i, int j, int k) noexcept {
-                amrex::Real pdt_lim = 1.0;
-                if (fx(i, j, k, 0) > tol && vof(i, j, k) > tol) {
-                    // VOF is removed from cell i
-                    pdt_lim = vof(i, j, k) * dx[0] / fx(i, j, k, 0);
-                } else if (fx(i, j, k, 0) < -tol && vof(i - 1, j, k) > tol) {
-                    // VOF is removed from cell i-1
-                    pdt_lim = vof(i - 1, j, k) * dx[0] / -fx(i, j, k, 0);
-                }
-                pdt_fab = amrex::min(pdt_fab, pdt_lim);
+    if (active_boxes.empty()) {
+        const auto& vof = mf_vof.const_arrays();
+        // Limit of the fluxes normal to a direction, just for vof fluxes
+        auto pdt_dir = [&](const amrex::MultiFab& mf_f, const int dir) {
+            const auto& f = mf_f.const_arrays();
+            const amrex::Real dx_dir = dx[dir];
+            return amrex::ParReduce(
+                amrex::TypeList<amrex::ReduceOpMin>{},
+                amrex::TypeList<amrex::Real>{}, mf_f, amrex::IntVect(0),
+                [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k)
+                    -> amrex::GpuTuple<amrex::Real> {
+                    return {pseudo_dt_limit(
+                        i, j, k, dir, dx_dir, tol, f[nbx], vof[nbx])};
+                });
+        };
+        const amrex::Real pdt_fx = pdt_dir(mf_fx, 0);
+        const amrex::Real pdt_fy = pdt_dir(mf_fy, 1);
+        const amrex::Real pdt_fz = pdt_dir(mf_fz, 2);
+        return amrex::min(1.0, amrex::min(pdt_fx, amrex::min(pdt_fy, pdt_fz)));
+    }
+
+    amrex::ReduceOps<amrex::ReduceOpMin> reduce_op;
+    amrex::ReduceData<amrex::Real> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+
+    for (amrex::MFIter mfi(mf_vof); mfi.isValid(); ++mfi) {
+        if (!box_is_active(active_boxes, mfi)) {
+            continue;
+        }
+        const auto& fx = mf_fx.const_array(mfi);
+        const auto& fy = mf_fy.const_array(mfi);
+        const auto& fz = mf_fz.const_array(mfi);
+        const auto& vof = mf_vof.const_array(mfi);
+        reduce_op.eval(
+            mfi.nodaltilebox(0), reduce_data,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                return {pseudo_dt_limit(i, j, k, 0, dx[0], tol, fx, vof)};
             });
-            return pdt_fab;
-        });
-    const amrex::Real pdt_fy = amrex::ReduceMin(
-        mf_fy, mf_vof, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx, amrex::Array4<amrex::Real const> const& fy,
-            amrex::Array4<amrex::Real const> const& vof) -> amrex::Real {
-            amrex::Real pdt_fab = 1.0;
-            amrex::Loop(bx, [=, &pdt_fab](int i, int j, int k) noexcept {
-                amrex::Real pdt_lim = 1.0;
-                if (fy(i, j, k, 0) > tol && vof(i, j, k) > tol) {
-                    // VOF is removed from cell j
-                    pdt_lim = vof(i, j, k) * dx[1] / fy(i, j, k, 0);
-                } else if (fy(i, j, k, 0) < -tol && vof(i, j - 1, k) > tol) {
-                    // VOF is removed from cell j-1
-                    pdt_lim = vof(i, j - 1, k) * dx[1] / -fy(i, j, k, 0);
-                }
-                pdt_fab = amrex::min(pdt_fab, pdt_lim);
+        reduce_op.eval(
+            mfi.nodaltilebox(1), reduce_data,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                return {pseudo_dt_limit(i, j, k, 1, dx[1], tol, fy, vof)};
             });
-            return pdt_fab;
-        });
-    const amrex::Real pdt_fz = amrex::ReduceMin(
-        mf_fz, mf_vof, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx, amrex::Array4<amrex::Real const> const& fz,
-            amrex::Array4<amrex::Real const> const& vof) -> amrex::Real {
-            amrex::Real pdt_fab = 1.0;
-            amrex::Loop(bx, [=, &pdt_fab](int i, int j, int k) noexcept {
-                amrex::Real pdt_lim = 1.0;
-                if (fz(i, j, k, 0) > tol && vof(i, j, k) > tol) {
-                    // VOF is removed from cell k
-                    pdt_lim = vof(i, j, k) * dx[2] / fz(i, j, k, 0);
-                } else if (fz(i, j, k, 0) < -tol && vof(i, j, k - 1) > tol) {
-                    // VOF is removed from cell k-1
-                    pdt_lim = vof(i, j, k - 1) * dx[2] / -fz(i, j, k, 0);
-                }
-                pdt_fab = amrex::min(pdt_fab, pdt_lim);
+        reduce_op.eval(
+            mfi.nodaltilebox(2), reduce_data,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                return {pseudo_dt_limit(i, j, k, 2, dx[2], tol, fz, vof)};
             });
-            return pdt_fab;
-        });
-    const amrex::Real pdt = amrex::min(pdt_fx, amrex::min(pdt_fy, pdt_fz));
+    }
+    const amrex::Real pdt =
+        amrex::min(1.0, amrex::get<0>(reduce_data.value(reduce_op)));
     return pdt;
 }
 
@@ -499,122 +550,116 @@ void apply_fluxes(
     amrex::MultiFab& mf_pressure,
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx,
     const amrex::Real ptfac,
-    const amrex::Real vof_tol)
+    const amrex::Real vof_tol,
+    const amrex::Vector<int>& active_boxes)
 {
-    const auto& fx = mf_fx.const_arrays();
-    const auto& fy = mf_fy.const_arrays();
-    const auto& fz = mf_fz.const_arrays();
-    const auto& sp = mf_psource.const_arrays();
-    const auto& vof = mf_vof.arrays();
-    const auto& dens = mf_dens.arrays();
-    const auto& vel = mf_vel.arrays();
-    const auto& gp = mf_gp.arrays();
-    const auto& p = mf_pressure.arrays();
+    if (active_boxes.empty()) {
+        const auto& fx = mf_fx.const_arrays();
+        const auto& fy = mf_fy.const_arrays();
+        const auto& fz = mf_fz.const_arrays();
+        const auto& sp = mf_psource.const_arrays();
+        const auto& vof = mf_vof.arrays();
+        const auto& dens = mf_dens.arrays();
+        const auto& vel = mf_vel.arrays();
+        const auto& gp = mf_gp.arrays();
+        const auto& p = mf_pressure.arrays();
+        amrex::ParallelFor(
+            mf_vof,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                apply_cell_fluxes(
+                    i, j, k, fx[nbx], fy[nbx], fz[nbx], vof[nbx], dens[nbx],
+                    vel[nbx], gp[nbx], dx, ptfac, vof_tol);
+            });
+        amrex::ParallelFor(
+            mf_pressure,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                p[nbx](i, j, k) += ptfac * sp[nbx](i, j, k);
+            });
+        return;
+    }
 
-    amrex::ParallelFor(
-        mf_vof, [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            const amrex::Real olddens = dens[nbx](i, j, k);
-            vof[nbx](i, j, k) +=
-                ptfac *
-                ((fx[nbx](i + 1, j, k, 0) - fx[nbx](i, j, k, 0)) / dx[0] +
-                 (fy[nbx](i, j + 1, k, 0) - fy[nbx](i, j, k, 0)) / dx[1] +
-                 (fz[nbx](i, j, k + 1, 0) - fz[nbx](i, j, k, 0)) / dx[2]);
-            dens[nbx](i, j, k) +=
-                ptfac *
-                ((fx[nbx](i + 1, j, k, 1) - fx[nbx](i, j, k, 1)) / dx[0] +
-                 (fy[nbx](i, j + 1, k, 1) - fy[nbx](i, j, k, 1)) / dx[1] +
-                 (fz[nbx](i, j, k + 1, 1) - fz[nbx](i, j, k, 1)) / dx[2]);
-            vel[nbx](i, j, k, 0) =
-                1.0 / dens[nbx](i, j, k) *
-                (olddens * vel[nbx](i, j, k, 0) +
-                 ptfac *
-                     ((fx[nbx](i + 1, j, k, 2) - fx[nbx](i, j, k, 2)) / dx[0] +
-                      (fy[nbx](i, j + 1, k, 2) - fy[nbx](i, j, k, 2)) / dx[1] +
-                      (fz[nbx](i, j, k + 1, 2) - fz[nbx](i, j, k, 2)) / dx[2]));
-            vel[nbx](i, j, k, 1) =
-                1.0 / dens[nbx](i, j, k) *
-                (olddens * vel[nbx](i, j, k, 1) +
-                 ptfac *
-                     ((fx[nbx](i + 1, j, k, 3) - fx[nbx](i, j, k, 3)) / dx[0] +
-                      (fy[nbx](i, j + 1, k, 3) - fy[nbx](i, j, k, 3)) / dx[1] +
-                      (fz[nbx](i, j, k + 1, 3) - fz[nbx](i, j, k, 3)) / dx[2]));
-            vel[nbx](i, j, k, 2) =
-                1.0 / dens[nbx](i, j, k) *
-                (olddens * vel[nbx](i, j, k, 2) +
-                 ptfac *
-                     ((fx[nbx](i + 1, j, k, 4) - fx[nbx](i, j, k, 4)) / dx[0] +
-                      (fy[nbx](i, j + 1, k, 4) - fy[nbx](i, j, k, 4)) / dx[1] +
-                      (fz[nbx](i, j, k + 1, 4) - fz[nbx](i, j, k, 4)) / dx[2]));
-            gp[nbx](i, j, k, 0) +=
-                ptfac *
-                ((fx[nbx](i + 1, j, k, 5) - fx[nbx](i, j, k, 5)) / dx[0] +
-                 (fy[nbx](i, j + 1, k, 5) - fy[nbx](i, j, k, 5)) / dx[1] +
-                 (fz[nbx](i, j, k + 1, 5) - fz[nbx](i, j, k, 5)) / dx[2]);
-            gp[nbx](i, j, k, 1) +=
-                ptfac *
-                ((fx[nbx](i + 1, j, k, 6) - fx[nbx](i, j, k, 6)) / dx[0] +
-                 (fy[nbx](i, j + 1, k, 6) - fy[nbx](i, j, k, 6)) / dx[1] +
-                 (fz[nbx](i, j, k + 1, 6) - fz[nbx](i, j, k, 6)) / dx[2]);
-            gp[nbx](i, j, k, 2) +=
-                ptfac *
-                ((fx[nbx](i + 1, j, k, 7) - fx[nbx](i, j, k, 7)) / dx[0] +
-                 (fy[nbx](i, j + 1, k, 7) - fy[nbx](i, j, k, 7)) / dx[1] +
-                 (fz[nbx](i, j, k + 1, 7) - fz[nbx](i, j, k, 7)) / dx[2]);
-
-            // Ensure vof is bounded
-            vof[nbx](i, j, k) =
-                vof[nbx](i, j, k) < vof_tol
-                    ? 0.0
-                    : (vof[nbx](i, j, k) > 1. - vof_tol ? 1.
-                                                        : vof[nbx](i, j, k));
-            // Density bounds are enforced elsewhere
-        });
-    amrex::ParallelFor(
-        mf_pressure,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
-            p[nbx](i, j, k) += ptfac * sp[nbx](i, j, k);
-        });
+    for (amrex::MFIter mfi(mf_vof); mfi.isValid(); ++mfi) {
+        if (!box_is_active(active_boxes, mfi)) {
+            continue;
+        }
+        const auto& bx = mfi.tilebox();
+        const auto& ndbx = mfi.nodaltilebox();
+        const auto& fx = mf_fx.const_array(mfi);
+        const auto& fy = mf_fy.const_array(mfi);
+        const auto& fz = mf_fz.const_array(mfi);
+        const auto& sp = mf_psource.const_array(mfi);
+        const auto& vof = mf_vof.array(mfi);
+        const auto& dens = mf_dens.array(mfi);
+        const auto& vel = mf_vel.array(mfi);
+        const auto& gp = mf_gp.array(mfi);
+        const auto& p = mf_pressure.array(mfi);
+        amrex::ParallelFor(
+            bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                apply_cell_fluxes(
+                    i, j, k, fx, fy, fz, vof, dens, vel, gp, dx, ptfac,
+                    vof_tol);
+            });
+        amrex::ParallelFor(
+            ndbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                p(i, j, k) += ptfac * sp(i, j, k);
+            });
+    }
 }
 
 // Get the size of the smallest VOF flux to quantify convergence
 amrex::Real measure_convergence(
-    amrex::MultiFab& mf_fx, amrex::MultiFab& mf_fy, amrex::MultiFab& mf_fz)
+    amrex::MultiFab& mf_fx,
+    amrex::MultiFab& mf_fy,
+    amrex::MultiFab& mf_fz,
+    const amrex::Vector<int>& active_boxes)
 {
     // Get the maximum flux magnitude, but just for vof fluxes
-    const amrex::Real err_fx = amrex::ReduceMax(
-        mf_fx, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx,
-            amrex::Array4<amrex::Real const> const& fx) -> amrex::Real {
-            amrex::Real err_fab = -1.0;
-            amrex::Loop(bx, [=, &err_fab](int i, int j, int k) noexcept {
-                err_fab = amrex::max(err_fab, std::abs(fx(i, j, k, 0)));
+    if (active_boxes.empty()) {
+        auto err_dir = [](const amrex::MultiFab& mf_f) {
+            const auto& f = mf_f.const_arrays();
+            return amrex::ParReduce(
+                amrex::TypeList<amrex::ReduceOpMax>{},
+                amrex::TypeList<amrex::Real>{}, mf_f, amrex::IntVect(0),
+                [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k)
+                    -> amrex::GpuTuple<amrex::Real> {
+                    return {std::abs(f[nbx](i, j, k, 0))};
+                });
+        };
+        const amrex::Real err_fx = err_dir(mf_fx);
+        const amrex::Real err_fy = err_dir(mf_fy);
+        const amrex::Real err_fz = err_dir(mf_fz);
+        return amrex::max(-1.0, amrex::max(err_fx, amrex::max(err_fy, err_fz)));
+    }
+
+    amrex::ReduceOps<amrex::ReduceOpMax> reduce_op;
+    amrex::ReduceData<amrex::Real> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+
+    for (amrex::MFIter mfi(mf_fx); mfi.isValid(); ++mfi) {
+        if (!box_is_active(active_boxes, mfi)) {
+            continue;
+        }
+        const auto& fx = mf_fx.const_array(mfi);
+        const auto& fy = mf_fy.const_array(mfi);
+        const auto& fz = mf_fz.const_array(mfi);
+        reduce_op.eval(
+            mfi.tilebox(), reduce_data,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                return {std::abs(fx(i, j, k, 0))};
             });
-            return err_fab;
-        });
-    const amrex::Real err_fy = amrex::ReduceMax(
-        mf_fy, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx,
-            amrex::Array4<amrex::Real const> const& fy) -> amrex::Real {
-            amrex::Real err_fab = -1.0;
-            amrex::Loop(bx, [=, &err_fab](int i, int j, int k) noexcept {
-                err_fab = amrex::max(err_fab, std::abs(fy(i, j, k, 0)));
+        reduce_op.eval(
+            mf_fy.box(mfi.index()), reduce_data,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                return {std::abs(fy(i, j, k, 0))};
             });
-            return err_fab;
-        });
-    const amrex::Real err_fz = amrex::ReduceMax(
-        mf_fz, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx,
-            amrex::Array4<amrex::Real const> const& fz) -> amrex::Real {
-            amrex::Real err_fab = -1.0;
-            amrex::Loop(bx, [=, &err_fab](int i, int j, int k) noexcept {
-                err_fab = amrex::max(err_fab, std::abs(fz(i, j, k, 0)));
+        reduce_op.eval(
+            mf_fz.box(mfi.index()), reduce_data,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+                return {std::abs(fz(i, j, k, 0))};
             });
-            return err_fab;
-        });
-    const amrex::Real err = amrex::max(err_fx, amrex::max(err_fy, err_fz));
+    }
+    const amrex::Real err =
+        amrex::max(-1.0, amrex::get<0>(reduce_data.value(reduce_op)));
     return err;
 }
 
@@ -105,34 +105,43 @@ namespace {
  *. Initializes the dimensions and grid length, sizes in SynthTurbData. Also
  *  allocates the necessary memory for the perturbation velocities.
  *
+ *  Only the I/O processor reads the file and broadcasts the details.
+ *
  *. \param turbFile Information regarding NetCDF data identifiers
  *. \param turbGrid Turbulence data
  */
 void process_nc_file(const std::string& turb_filename, SynthTurbData& turb_grid)
 {
 #ifdef AMR_WIND_USE_NETCDF
-    auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
-
-    // Grid dimensions
-    AMREX_ASSERT(ncf.dim("ndim").len() == AMREX_SPACEDIM);
-    auto nx = ncf.dim("nx").len();
-    auto ny = ncf.dim("ny").len();
-    auto nz = ncf.dim("nz").len();
-
-    turb_grid.box_dims[0] = static_cast<int>(nx);
-    turb_grid.box_dims[1] = static_cast<int>(ny);
-    turb_grid.box_dims[2] = static_cast<int>(nz);
-
-    // Box lengths and resolution
-    auto box_len = ncf.var("box_lengths");
-    box_len.get(turb_grid.box_len.data());
-    auto dx = ncf.var("dx");
-    dx.get(turb_grid.dx.data());
-
-    ncf.close();
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
+
+        // Grid dimensions
+        AMREX_ASSERT(ncf.dim("ndim").len() == AMREX_SPACEDIM);
+        turb_grid.box_dims[0] = static_cast<int>(ncf.dim("nx").len());
+        turb_grid.box_dims[1] = static_cast<int>(ncf.dim("ny").len());
+        turb_grid.box_dims[2] = static_cast<int>(ncf.dim("nz").len());
+
+        // Box lengths and resolution
+        auto box_len = ncf.var("box_lengths");
+        box_len.get(turb_grid.box_len.data());
+        auto dx = ncf.var("dx");
+        dx.get(turb_grid.dx.data());
+
+        ncf.close();
+    }
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.box_dims.data(), AMREX_SPACEDIM, ioproc);
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.box_len.data(), AMREX_SPACEDIM, ioproc);
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.dx.data(), AMREX_SPACEDIM, ioproc);
 
     // Create data structures to store the perturbation velocities for two
     // planes
+    const size_t ny = turb_grid.box_dims[1];
+    const size_t nz = turb_grid.box_dims[2];
     const size_t grid_size = 2 * ny * nz;
     turb_grid.uvel.resize(grid_size);
     turb_grid.vvel.resize(grid_size);
@@ -145,10 +154,72 @@ void process_nc_file(const std::string& turb_filename, SynthTurbData& turb_grid)
 #endif
 }
 
+/** Read consecutive planes of data into the host cache
+ *
+ *  The I/O processor reads `num_cache_planes` planes starting at plane `il`,
+ *  wrapping around the end of the box, and broadcasts them to all the other
+ *  processes.
+ */
+void read_turb_planes(
+    const std::string& turb_filename, SynthTurbData& turb_grid, const int il)
+{
+    BL_PROFILE("amr-wind::SyntheticTurbulence::read_planes");
+#ifdef AMR_WIND_USE_NETCDF
+    const int nx = turb_grid.box_dims[0];
+    const auto ny = static_cast<size_t>(turb_grid.box_dims[1]);
+    const auto nz = static_cast<size_t>(turb_grid.box_dims[2]);
+    const size_t plane_size = ny * nz;
+    const int nplanes = turb_grid.num_cache_planes;
+    const size_t cache_len = static_cast<size_t>(nplanes) * plane_size;
+    turb_grid.uvel_cache.resize(cache_len);
+    turb_grid.vvel_cache.resize(cache_len);
+    turb_grid.wvel_cache.resize(cache_len);
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
+        auto uvel = ncf.var("uvel");
+        auto vvel = ncf.var("vvel");
+        auto wvel = ncf.var("wvel");
+
+        // Read the planes up to the end of the box in one shot, and the
+        // remaining planes from the start of the box
+        int first = il;
+        int remaining = nplanes;
+        size_t offset = 0;
+        while (remaining > 0) {
+            const int nread = amrex::min(remaining, nx - first);
+            std::vector<size_t> start{static_cast<size_t>(first), 0, 0};
+            std::vector<size_t> count{static_cast<size_t>(nread), ny, nz};
+            uvel.get(&turb_grid.uvel_cache[offset], start, count);
+            vvel.get(&turb_grid.vvel_cache[offset], start, count);
+            wvel.get(&turb_grid.wvel_cache[offset], start, count);
+            offset += nread * plane_size;
+            remaining -= nread;
+            first = 0;
+        }
+
+        ncf.close();
+    }
+
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.uvel_cache.data(), cache_len, ioproc);
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.vvel_cache.data(), cache_len, ioproc);
+    amrex::ParallelDescriptor::Bcast(
+        turb_grid.wvel_cache.data(), cache_len, ioproc);
+
+    turb_grid.cache_start = il;
+#else
+    amrex::ignore_unused(turb_filename, turb_grid, il);
+#endif
+}
+
 /** Load two planes of data that bound the current timestep
  *
  *  The data for the y and z directions are loaded for the entire grid at the
- * two planes
+ * two planes. The planes are read from the file only when they are not in
+ * the host cache.
  */
 void load_turb_plane_data(
     const std::string& turb_filename,
@@ -157,45 +228,33 @@ void load_turb_plane_data(
     const int ir)
 {
     BL_PROFILE("amr-wind::SyntheticTurbulence::load_plane_data");
-#ifdef AMR_WIND_USE_NETCDF
-    auto ncf = ncutils::NCFile::open(turb_filename, NC_NOWRITE);
-
-    // clang-format off
-    std::vector<size_t> start{static_cast<size_t>(il), 0, 0};
-    std::vector<size_t> count{2, static_cast<size_t>(turb_grid.box_dims[1]),
-                               static_cast<size_t>(turb_grid.box_dims[2])};
-    // clang-format on
-
-    auto uvel = ncf.var("uvel");
-    auto vvel = ncf.var("vvel");
-    auto wvel = ncf.var("wvel");
-
-    if ((ir - il) == 1) {
-        // two consecutive planes load them in one shot
-        uvel.get(turb_grid.uvel.data(), start, count);
-        vvel.get(turb_grid.vvel.data(), start, count);
-        wvel.get(turb_grid.wvel.data(), start, count);
-    } else {
-        // Load the planes separately
-        count[0] = 1;
-        uvel.get(turb_grid.uvel.data(), start, count);
-        vvel.get(turb_grid.vvel.data(), start, count);
-        wvel.get(turb_grid.wvel.data(), start, count);
-
-        start[0] = static_cast<size_t>(ir);
-        const size_t offset = static_cast<size_t>(turb_grid.box_dims[1]) *
+    const int nx = turb_grid.box_dims[0];
+    const auto cache_index = [&](const int i) {
+        return (i - turb_grid.cache_start + nx) % nx;
+    };
+    if ((turb_grid.cache_start < 0) ||
+        (cache_index(il) >= turb_grid.num_cache_planes) ||
+        (cache_index(ir) >= turb_grid.num_cache_planes)) {
+        read_turb_planes(turb_filename, turb_grid, il);
+    }
+
+    const size_t plane_size = static_cast<size_t>(turb_grid.box_dims[1]) *
                               static_cast<size_t>(turb_grid.box_dims[2]);
-        uvel.get(&turb_grid.uvel[offset], start, count);
-        vvel.get(&turb_grid.vvel[offset], start, count);
-        wvel.get(&turb_grid.wvel[offset], start, count);
+    const size_t loff = cache_index(il) * plane_size;
+    const size_t roff = cache_index(ir) * plane_size;
+    for (size_t n = 0; n < plane_size; ++n) {
+        turb_grid.uvel[n] = turb_grid.uvel_cache[loff + n];
+        turb_grid.vvel[n] = turb_grid.vvel_cache[loff + n];
+        turb_grid.wvel[n] = turb_grid.wvel_cache[loff + n];
+        turb_grid.uvel[plane_size + n] = turb_grid.uvel_cache[roff + n];
+        turb_grid.vvel[plane_size + n] = turb_grid.vvel_cache[roff + n];
+        turb_grid.wvel[plane_size + n] = turb_grid.wvel_cache[roff + n];
     }
 
     // Update left and right indices for future checks
     turb_grid.ileft = il;
     turb_grid.iright = ir;
 
-    ncf.close();
-
     amrex::Gpu::copy(
         amrex::Gpu::hostToDevice, turb_grid.uvel.begin(), turb_grid.uvel.end(),
         turb_grid.uvel_d.begin());
@@ -205,9 +264,6 @@ void load_turb_plane_data(
     amrex::Gpu::copy(
         amrex::Gpu::hostToDevice, turb_grid.wvel.begin(), turb_grid.wvel.end(),
         turb_grid.wvel_d.begin());
-#else
-    amrex::ignore_unused(turb_filename, turb_grid, il, ir);
-#endif
 }
 
 /** Determine the left/right indices for a given point along a particular
@@ -370,6 +426,20 @@ SyntheticTurbulence::SyntheticTurbulence(const CFDSim& sim)
     pp.query("turbulence_file", m_turb_filename);
     process_nc_file(m_turb_filename, m_turb_grid);
 
+    // Number of planes read ahead of the bounding planes, or keep the entire
+    // box in memory if its size (in MB) does not exceed the given limit
+    int prefetch_planes = 0;
+    pp.query("prefetch_planes", prefetch_planes);
+    amrex::Real max_resident_size = 0.0;
+    pp.query("max_resident_size", max_resident_size);
+    const int nx = m_turb_grid.box_dims[0];
+    const amrex::Real box_size =
+        3.0 * sizeof(double) * nx * m_turb_grid.box_dims[1] *
+        m_turb_grid.box_dims[2] / (1024.0 * 1024.0);
+    m_turb_grid.num_cache_planes = (box_size <= max_resident_size)
+                                       ? nx
+                                       : amrex::min(nx, 2 + prefetch_planes);
+
     // Load position and orientation of the grid
     amrex::Real wind_direction{270.};
     pp.query("wind_direction", wind_direction);
@@ -468,6 +538,8 @@ SyntheticTurbulence::SyntheticTurbulence(const CFDSim& sim)
                    << "]\n"
                    << "  Grid dx = [" << m_turb_grid.dx[0] << ", "
                    << m_turb_grid.dx[1] << ", " << m_turb_grid.dx[2] << "]\n"
+                   << "  Cached planes = " << m_turb_grid.num_cache_planes
+                   << "\n"
                    << "  Centroid (forcing plane) = [" << m_turb_grid.origin[0]
                    << ", " << m_turb_grid.origin[1] << ", "
                    << m_turb_grid.origin[2] << "]\n"
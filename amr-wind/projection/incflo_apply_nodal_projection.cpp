@@ -3,6 +3,7 @@
 #include "amr-wind/incflo.H"
 #include "amr-wind/core/MLMGOptions.H"
 #include "amr-wind/utilities/console_io.H"
+#include "amr-wind/utilities/PerfLog.H"
 #include "amr-wind/core/field_ops.H"
 #include "amr-wind/projection/nodal_projection_ops.H"
 #include "hydro_utils.H"
@@ -99,6 +100,232 @@ void amr_wind::nodal_projection::enforce_inout_solvability(
     HydroUtils::enforceInOutSolvability(vel_vec, bc_type, geom, true);
 }
 
+#ifdef AMR_WIND_USE_FFT
+/** Initial guess of a multi-level nodal projection with constant coefficient
+ *
+ *  The cell-centered Poisson problem for the divergence of the level 0
+ *  velocity is solved exactly with FFTs and averaged to the nodes, mirroring
+ *  the solution across the domain boundaries (so that it vanishes on
+ *  Dirichlet boundaries). The result is injected (piecewise constant) to the
+ *  finer levels. The guess is that of a projection with a unit coefficient.
+ */
+void amr_wind::nodal_projection::fft_coarse_guess(
+    amrex::FFT::Poisson<amrex::MultiFab>& fft,
+    const Array<amrex::LinOpBCType, AMREX_SPACEDIM>& bclo,
+    const Array<amrex::LinOpBCType, AMREX_SPACEDIM>& bchi,
+    const amrex::AmrCore& mesh,
+    const Vector<MultiFab*>& vel,
+    const Vector<MultiFab*>& phi)
+{
+    BL_PROFILE("amr-wind::nodal_projection::fft_coarse_guess");
+
+    const auto& geom = mesh.Geom(0);
+    const auto& ba = mesh.boxArray(0);
+    const auto& dm = mesh.DistributionMap(0);
+
+    // Divergence of the cell-centered velocity (ghost cells on the domain
+    // boundaries hold the boundary velocities)
+    MultiFab vel0(ba, dm, AMREX_SPACEDIM, 1);
+    MultiFab::Copy(vel0, *vel[0], 0, 0, AMREX_SPACEDIM, 1);
+    vel0.FillBoundary(geom.periodicity());
+    MultiFab rhs(ba, dm, 1, 0);
+    const auto& dxinv = geom.InvCellSizeArray();
+    const auto& vel_arrs = vel0.const_arrays();
+    const auto& rhs_arrs = rhs.arrays();
+    amrex::ParallelFor(
+        rhs, [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+            const auto& u = vel_arrs[nbx];
+            rhs_arrs[nbx](i, j, k) =
+                0.5 * (dxinv[0] * (u(i + 1, j, k, 0) - u(i - 1, j, k, 0)) +
+                       dxinv[1] * (u(i, j + 1, k, 1) - u(i, j - 1, k, 1)) +
+                       dxinv[2] * (u(i, j, k + 1, 2) - u(i, j, k - 1, 2)));
+        });
+
+    MultiFab soln(ba, dm, 1, 1);
+    soln.setVal(0.0);
+    fft.solve(soln, rhs);
+    soln.FillBoundary(geom.periodicity());
+
+    const auto& domain = geom.Domain();
+    const auto dlo = domain.smallEnd();
+    const auto dhi = domain.bigEnd();
+    amrex::GpuArray<int, AMREX_SPACEDIM> periodic;
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> sign_lo;
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> sign_hi;
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        periodic[dir] = static_cast<int>(geom.isPeriodic(dir));
+        sign_lo[dir] = (bclo[dir] == LinOpBCType::Dirichlet) ? -1.0 : 1.0;
+        sign_hi[dir] = (bchi[dir] == LinOpBCType::Dirichlet) ? -1.0 : 1.0;
+    }
+
+    phi[0]->setVal(0.0);
+    const auto& soln_arrs = soln.const_arrays();
+    const auto& phi_arrs = phi[0]->arrays();
+    amrex::ParallelFor(
+        *phi[0], [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+            amrex::Real val = 0.0;
+            for (int kk = k - 1; kk <= k; ++kk) {
+                for (int jj = j - 1; jj <= j; ++jj) {
+                    for (int ii = i - 1; ii <= i; ++ii) {
+                        amrex::IntVect iv(ii, jj, kk);
+                        amrex::Real fac = 0.125;
+                        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+                            if (periodic[dir] == 1) {
+                                continue;
+                            }
+                            if (iv[dir] < dlo[dir]) {
+                                iv[dir] = dlo[dir];
+                                fac *= sign_lo[dir];
+                            } else if (iv[dir] > dhi[dir]) {
+                                iv[dir] = dhi[dir];
+                                fac *= sign_hi[dir];
+                            }
+                        }
+                        val += fac * soln_arrs[nbx](iv);
+                    }
+                }
+            }
+            phi_arrs[nbx](i, j, k) = val;
+        });
+
+    for (int lev = 1; lev < static_cast<int>(phi.size()); ++lev) {
+        auto& phif = *phi[lev];
+        const amrex::IntVect rr = mesh.refRatio(lev - 1);
+        MultiFab crse(
+            amrex::coarsen(phif.boxArray(), rr), phif.DistributionMap(), 1, 0);
+        crse.ParallelCopy(
+            *phi[lev - 1], 0, 0, 1, 0, 0, mesh.Geom(lev - 1).periodicity());
+
+        phif.setVal(0.0);
+        const auto& phif_arrs = phif.arrays();
+        const auto& crse_arrs = crse.const_arrays();
+        amrex::ParallelFor(
+            phif, [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                const amrex::IntVect civ =
+                    amrex::coarsen(amrex::IntVect(i, j, k), rr);
+                phif_arrs[nbx](i, j, k) = crse_arrs[nbx](civ);
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+#endif
+
+/** Create the persistent nodal projector
+ *
+ *  The projector is stored on incflo and reused by subsequent calls to
+ *  incflo::ApplyProjection; only the coefficients are updated between calls.
+ *  It is rebuilt after a regrid or when the coefficient structure changes.
+ *
+ *  \param vel Velocity multifabs that are projected
+ *  \param variable_sigma Flag indicating a spatially varying coefficient
+ */
+void incflo::init_nodal_projector(
+    const Vector<MultiFab*>& vel, const bool variable_sigma)
+{
+    BL_PROFILE("amr-wind::incflo::init_nodal_projector");
+
+    auto& pressure = m_repo.get_field("p");
+    auto bclo = amr_wind::nodal_projection::get_projection_bc(
+        Orientation::low, pressure, m_sim.mesh().Geom()[0].isPeriodic());
+    auto bchi = amr_wind::nodal_projection::get_projection_bc(
+        Orientation::high, pressure, m_sim.mesh().Geom()[0].isPeriodic());
+
+    if (variable_sigma) {
+        m_nodal_proj = std::make_unique<Hydro::NodalProjector>(
+            vel, GetVecOfConstPtrs(m_nodal_proj_sigma), Geom(0, finest_level),
+            m_nodal_proj_options->lpinfo());
+    } else {
+        m_nodal_proj_sigma.clear();
+        m_nodal_proj = std::make_unique<Hydro::NodalProjector>(
+            vel, 1.0, Geom(0, finest_level), m_nodal_proj_options->lpinfo());
+    }
+
+    // Set MLMG and NodalProjector options
+    (*m_nodal_proj_options)(*m_nodal_proj);
+    m_nodal_proj->setDomainBC(bclo, bchi);
+
+    m_nodal_proj_vel = vel;
+    m_nodal_proj_variable_sigma = variable_sigma;
+
+#ifdef AMR_WIND_USE_FFT
+    if (m_nodal_proj_fft_guess && !variable_sigma && (finest_level > 0) &&
+        !m_nodal_proj_fft) {
+        m_nodal_proj_fft =
+            std::make_unique<amrex::FFT::Poisson<amrex::MultiFab>>(
+                Geom(0), amr_wind::projection::get_fft_bc(bclo, bchi));
+    }
+#endif
+}
+
+/** Initial guess of the nodal projection from the pressure history
+ *
+ *  The pressure is linearly extrapolated in time from the two latest
+ *  projections. For the incremental form the guess is the extrapolated
+ *  change of the pressure. Returns false if the history is not available,
+ *  in which case the projection starts from zero.
+ */
+bool incflo::nodal_projection_guess(
+    const Vector<MultiFab*>& phi,
+    const Real time,
+    const Real phi_scale,
+    const bool incremental)
+{
+    const int nhist = static_cast<int>(m_nodal_proj_p_hist.size());
+    if ((nhist == 0) || (incremental && nhist < 2)) {
+        return false;
+    }
+
+    BL_PROFILE("amr-wind::incflo::nodal_projection_guess");
+    const Real t1 = m_nodal_proj_p_time[nhist - 1];
+    const Real fac =
+        (nhist < 2) ? 0.0 : (time - t1) / (t1 - m_nodal_proj_p_time[0]);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        const auto& p1 = m_nodal_proj_p_hist[nhist - 1][lev];
+        phi[lev]->setVal(0.0);
+        if (!incremental) {
+            MultiFab::Copy(*phi[lev], p1, 0, 0, 1, 0);
+        }
+        if (nhist > 1) {
+            const auto& p0 = m_nodal_proj_p_hist[0][lev];
+            MultiFab::Saxpy(*phi[lev], fac, p1, 0, 0, 1, 0);
+            MultiFab::Saxpy(*phi[lev], -fac, p0, 0, 0, 1, 0);
+        }
+        phi[lev]->mult(phi_scale, 0, 1, 0);
+    }
+    return true;
+}
+
+/** Record the pressure after a nodal projection
+ *
+ *  Projections at the same time as the latest entry (e.g., the corrector
+ *  step) replace that entry.
+ */
+void incflo::update_nodal_projection_history(const Real time)
+{
+    BL_PROFILE("amr-wind::incflo::update_nodal_projection_history");
+    if (m_nodal_proj_p_time.empty() || (time != m_nodal_proj_p_time.back())) {
+        if (m_nodal_proj_p_hist.size() == 2) {
+            std::swap(m_nodal_proj_p_hist[0], m_nodal_proj_p_hist[1]);
+            std::swap(m_nodal_proj_p_time[0], m_nodal_proj_p_time[1]);
+            m_nodal_proj_p_time.pop_back();
+        } else {
+            m_nodal_proj_p_hist.emplace_back(finest_level + 1);
+        }
+        m_nodal_proj_p_time.push_back(time);
+    }
+
+    const auto& pressure = m_repo.get_field("p");
+    auto& p_hist = m_nodal_proj_p_hist.back();
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        if (!p_hist[lev].ok()) {
+            p_hist[lev].define(
+                pressure(lev).boxArray(), pressure(lev).DistributionMap(), 1,
+                0);
+        }
+        MultiFab::Copy(p_hist[lev], pressure(lev), 0, 0, 1, 0);
+    }
+}
+
 /** Perform nodal projection
  *
  *  Computes the following decomposition:
@@ -156,6 +383,7 @@ void incflo::ApplyProjection(
     bool incremental)
 {
     BL_PROFILE("amr-wind::incflo::ApplyProjection");
+    amr_wind::PerfLog::Timer timer(amr_wind::PerfLog::NodalProjection);
 
     // If we have dropped the dt substantially for whatever reason,
     // use a different form of the approximate projection that
@@ -178,6 +406,7 @@ void incflo::ApplyProjection(
          m_sim.physics_manager().contains("MultiPhase"));
 
     bool mesh_mapping = m_sim.has_mesh_mapping();
+    const bool variable_sigma = variable_density || mesh_mapping;
 
     auto& grad_p = m_repo.get_field("gp");
     auto& pressure = m_repo.get_field("p");
@@ -258,53 +487,7 @@ void incflo::ApplyProjection(
         velocity.to_uniform_space();
     }
 
-    // Create sigma while accounting for mesh mapping
-    // sigma = 1/(fac^2)*J * dt/rho
-    Vector<amrex::MultiFab> sigma(finest_level + 1);
-    if (variable_density || mesh_mapping) {
-        int ncomp = mesh_mapping ? AMREX_SPACEDIM : 1;
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            sigma[lev].define(
-                grids[lev], dmap[lev], ncomp, 0, MFInfo(), Factory(lev));
-            const auto& sig_arrs = sigma[lev].arrays();
-            const auto& rho_arrs = density[lev]->const_arrays();
-            const auto& fac_arrs =
-                mesh_mapping ? ((*mesh_fac)(lev).const_arrays())
-                             : amrex::MultiArray4<amrex::Real const>();
-            const auto& detJ_arrs =
-                mesh_mapping ? ((*mesh_detJ)(lev).const_arrays())
-                             : amrex::MultiArray4<amrex::Real const>();
-            const auto& ref_rho_arrs =
-                is_anelastic ? (*ref_density)(lev).const_arrays()
-                             : amrex::MultiArray4<amrex::Real const>();
-
-            amrex::ParallelFor(
-                sigma[lev], amrex::IntVect(0), ncomp,
-                [=] AMREX_GPU_DEVICE(
-                    int nbx, int i, int j, int k, int n) noexcept {
-                    amrex::Real fac_cc =
-                        mesh_mapping ? (fac_arrs[nbx](i, j, k, n)) : 1.0;
-                    amrex::Real det_j =
-                        mesh_mapping ? (detJ_arrs[nbx](i, j, k)) : 1.0;
-                    sig_arrs[nbx](i, j, k, n) = std::pow(fac_cc, -2.) * det_j *
-                                                scaling_factor /
-                                                rho_arrs[nbx](i, j, k);
-                    if (is_anelastic) {
-                        sig_arrs[nbx](i, j, k, n) *= ref_rho_arrs[nbx](i, j, k);
-                    }
-                });
-        }
-        amrex::Gpu::streamSynchronize();
-    }
-
     // Perform projection
-    std::unique_ptr<Hydro::NodalProjector> nodal_projector;
-
-    auto bclo = amr_wind::nodal_projection::get_projection_bc(
-        Orientation::low, pressure, m_sim.mesh().Geom()[0].isPeriodic());
-    auto bchi = amr_wind::nodal_projection::get_projection_bc(
-        Orientation::high, pressure, m_sim.mesh().Geom()[0].isPeriodic());
-
     Vector<MultiFab*> vel;
     for (int lev = 0; lev <= finest_level; ++lev) {
         vel.push_back(&(velocity(lev)));
@@ -340,25 +523,88 @@ void incflo::ApplyProjection(
             velocity, m_repo.mesh().Geom(), m_repo.num_active_levels());
     }
 
-    amr_wind::MLMGOptions options("nodal_proj");
+    // The persistent projector is rebuilt after a regrid, when the velocity
+    // storage has moved, or every time for overset (masks change in time)
+    const bool need_init =
+        (!m_reuse_nodal_proj || !m_nodal_proj || m_sim.has_overset() ||
+         (variable_sigma != m_nodal_proj_variable_sigma) ||
+         (vel != m_nodal_proj_vel));
 
-    if (variable_density || mesh_mapping) {
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(
-            vel, GetVecOfConstPtrs(sigma), Geom(0, finest_level),
-            options.lpinfo());
-    } else {
-        amrex::Real rho_0 = 1.0;
-        amrex::ParmParse pp("incflo");
-        pp.query("density", rho_0);
+    // Create sigma while accounting for mesh mapping
+    // sigma = 1/(fac^2)*J * dt/rho
+    if (variable_sigma) {
+        int ncomp = mesh_mapping ? AMREX_SPACEDIM : 1;
+        if (need_init) {
+            m_nodal_proj.reset();
+            m_nodal_proj_sigma.clear();
+            m_nodal_proj_sigma.resize(finest_level + 1);
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                m_nodal_proj_sigma[lev].define(
+                    grids[lev], dmap[lev], ncomp, 0, MFInfo(), Factory(lev));
+            }
+        }
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            auto& sigma = m_nodal_proj_sigma[lev];
+            const auto& sig_arrs = sigma.arrays();
+            const auto& rho_arrs = density[lev]->const_arrays();
+            const auto& fac_arrs =
+                mesh_mapping ? ((*mesh_fac)(lev).const_arrays())
+                             : amrex::MultiArray4<amrex::Real const>();
+            const auto& detJ_arrs =
+                mesh_mapping ? ((*mesh_detJ)(lev).const_arrays())
+                             : amrex::MultiArray4<amrex::Real const>();
+            const auto& ref_rho_arrs =
+                is_anelastic ? (*ref_density)(lev).const_arrays()
+                             : amrex::MultiArray4<amrex::Real const>();
 
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(
-            vel, scaling_factor / rho_0, Geom(0, finest_level),
-            options.lpinfo());
+            amrex::ParallelFor(
+                sigma, amrex::IntVect(0), ncomp,
+                [=] AMREX_GPU_DEVICE(
+                    int nbx, int i, int j, int k, int n) noexcept {
+                    amrex::Real fac_cc =
+                        mesh_mapping ? (fac_arrs[nbx](i, j, k, n)) : 1.0;
+                    amrex::Real det_j =
+                        mesh_mapping ? (detJ_arrs[nbx](i, j, k)) : 1.0;
+                    sig_arrs[nbx](i, j, k, n) = std::pow(fac_cc, -2.) * det_j *
+                                                scaling_factor /
+                                                rho_arrs[nbx](i, j, k);
+                    if (is_anelastic) {
+                        sig_arrs[nbx](i, j, k, n) *= ref_rho_arrs[nbx](i, j, k);
+                    }
+                });
+        }
+        amrex::Gpu::streamSynchronize();
     }
 
-    // Set MLMG and NodalProjector options
-    options(*nodal_projector);
-    nodal_projector->setDomainBC(bclo, bchi);
+    // For constant density the projector is built with a unit coefficient so
+    // that it is independent of dt; phi is rescaled after the solve
+    const amrex::Real phi_scale =
+        variable_sigma ? 1.0 : scaling_factor / m_nodal_proj_rho0;
+
+    if (need_init) {
+        init_nodal_projector(vel, variable_sigma);
+    } else if (variable_sigma) {
+        BL_PROFILE("amr-wind::incflo::ApplyProjection::update_sigma");
+        auto& linop = m_nodal_proj->getLinOp();
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            linop.setSigma(lev, m_nodal_proj_sigma[lev]);
+        }
+    }
+    auto& nodal_projector = m_nodal_proj;
+
+    // A reused projector still holds the solution of the previous projection,
+    // which is not a valid initial guess
+    const auto project_from_zero = [&]() {
+        for (auto* phi : nodal_projector->getPhi()) {
+            phi->setVal(0.0);
+        }
+        nodal_projector->project(
+            m_nodal_proj_options->rel_tol, m_nodal_proj_options->abs_tol);
+    };
+
+    // Overset projections already start from the current pressure
+    const bool warm_start =
+        m_nodal_proj_warm_start && !m_sim.has_overset() && (time > 0.0);
 
     bool has_ib = m_sim.physics_manager().contains("IB");
     if (has_ib) {
@@ -391,12 +637,60 @@ void incflo::ApplyProjection(
             }
         } else {
             amr_wind::field_ops::copy(*phif, pressure, 0, 0, 1, 1);
+            if (!variable_sigma) {
+                for (int lev = 0; lev <= finestLevel(); ++lev) {
+                    (*phif)(lev).mult(phi_scale, 0, 1, 1);
+                }
+            }
         }
 
+        BL_PROFILE_VAR("amr-wind::incflo::ApplyProjection::solve", proj_solve);
         nodal_projector->project(
-            phif->vec_ptrs(), options.rel_tol, options.abs_tol);
+            phif->vec_ptrs(), m_nodal_proj_options->rel_tol,
+            m_nodal_proj_options->abs_tol);
+        BL_PROFILE_VAR_STOP(proj_solve);
     } else {
-        nodal_projector->project(options.rel_tol, options.abs_tol);
+        // Initial guess from the pressure history, or else from a level 0
+        // FFT solve
+        std::unique_ptr<amr_wind::ScratchField> phif;
+        bool has_guess = false;
+        if (warm_start) {
+            phif = m_repo.create_scratch_field(1, 1, amr_wind::FieldLoc::NODE);
+            has_guess = nodal_projection_guess(
+                phif->vec_ptrs(), time, phi_scale, incremental);
+        }
+#ifdef AMR_WIND_USE_FFT
+        if (!has_guess && m_nodal_proj_fft && !variable_sigma &&
+            !is_anelastic && !has_ib && (finest_level > 0)) {
+            if (!phif) {
+                phif = m_repo.create_scratch_field(
+                    1, 1, amr_wind::FieldLoc::NODE);
+            }
+            const auto& periodic = geom[0].isPeriodic();
+            amr_wind::nodal_projection::fft_coarse_guess(
+                *m_nodal_proj_fft,
+                amr_wind::nodal_projection::get_projection_bc(
+                    Orientation::low, pressure, periodic),
+                amr_wind::nodal_projection::get_projection_bc(
+                    Orientation::high, pressure, periodic),
+                m_repo.mesh(), vel, phif->vec_ptrs());
+            has_guess = true;
+        }
+#endif
+
+        BL_PROFILE_VAR("amr-wind::incflo::ApplyProjection::solve", proj_solve);
+        if (has_guess) {
+            nodal_projector->project(
+                phif->vec_ptrs(), m_nodal_proj_options->rel_tol,
+                m_nodal_proj_options->abs_tol);
+        } else {
+            project_from_zero();
+        }
+        BL_PROFILE_VAR_STOP(proj_solve);
+        if (warm_start) {
+            ++m_nodal_proj_num_solves;
+            m_nodal_proj_num_iters += nodal_projector->getMLMG().getNumIters();
+        }
     }
 
     amr_wind::io::print_mlmg_info(
@@ -425,9 +719,11 @@ void incflo::ApplyProjection(
         }
     }
 
-    // Get phi and fluxes
+    // Get phi and fluxes, rescaled while copied so that the projector keeps
+    // its own solution unchanged
     auto phi = nodal_projector->getPhi();
     auto gradphi = nodal_projector->getGradPhi();
+    const amrex::Real inv_phi_scale = 1.0 / phi_scale;
 
     for (int lev = 0; lev <= finest_level; lev++) {
 
@@ -445,26 +741,34 @@ void incflo::ApplyProjection(
                 amrex::ParallelFor(
                     tbx, AMREX_SPACEDIM,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        gp_lev(i, j, k, n) += gp_proj(i, j, k, n);
+                        gp_lev(i, j, k, n) +=
+                            inv_phi_scale * gp_proj(i, j, k, n);
                     });
                 amrex::ParallelFor(
                     nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        p_lev(i, j, k) += p_proj(i, j, k);
+                        p_lev(i, j, k) += inv_phi_scale * p_proj(i, j, k);
                     });
             } else {
                 amrex::ParallelFor(
                     tbx, AMREX_SPACEDIM,
                     [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
-                        gp_lev(i, j, k, n) = gp_proj(i, j, k, n);
+                        gp_lev(i, j, k, n) =
+                            inv_phi_scale * gp_proj(i, j, k, n);
                     });
                 amrex::ParallelFor(
                     nbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        p_lev(i, j, k) = p_proj(i, j, k);
+                        p_lev(i, j, k) = inv_phi_scale * p_proj(i, j, k);
                     });
             }
         }
     }
 
+    // Pressure history for the next projections, excluding the initial
+    // projection and iterations that do not compute the physical pressure
+    if (warm_start) {
+        update_nodal_projection_history(time);
+    }
+
     // Determine if reference pressure should be added back
     if (m_reconstruct_true_pressure && time != 0.0) {
         const auto& p0 = m_repo.get_field("reference_pressure");
@@ -51,6 +51,7 @@ void incflo::ReadParameters()
         ParmParse pp("incflo");
 
         pp.query("verbose", m_verbose);
+        pp.query("perf_log", m_perf_log);
 
         pp.query("initial_iterations", m_initial_iterations);
         pp.query("do_initial_proj", m_do_initial_proj);
@@ -91,6 +92,22 @@ void incflo::ReadParameters()
         amrex::ParmParse pp("ICNS");
         pp.query("reconstruct_true_pressure", m_reconstruct_true_pressure);
     }
+
+    {
+        amrex::ParmParse pp("incflo");
+        pp.query("density", m_nodal_proj_rho0);
+    }
+
+    {
+        amrex::ParmParse pp("nodal_proj");
+        pp.query("reuse_projector", m_reuse_nodal_proj);
+        pp.query("warm_start", m_nodal_proj_warm_start);
+#ifdef AMR_WIND_USE_FFT
+        pp.query("use_fft_coarse_guess", m_nodal_proj_fft_guess);
+#endif
+        m_nodal_proj_options =
+            std::make_unique<amr_wind::MLMGOptions>("nodal_proj");
+    }
 }
 
 /** Perform initial pressure iterations
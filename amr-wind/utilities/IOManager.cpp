@@ -10,8 +10,10 @@
 #include "amr-wind/utilities/io_utils.H"
 #include "amr-wind/utilities/DerivedQuantity.H"
 #include "amr-wind/utilities/DerivedQtyDefs.H"
+#include "amr-wind/utilities/PerfLog.H"
 #include "amr-wind/utilities/ncutils/nc_interface.H"
 
+#include "AMReX_AsyncOut.H"
 #include "AMReX_ParmParse.H"
 #include "AMReX_PlotFileUtil.H"
 #include "AMReX_MultiFabUtil.H"
@@ -132,6 +134,9 @@ void IOManager::initialize_io()
 void IOManager::write_plot_file()
 {
     BL_PROFILE("amr-wind::IOManager::write_plot_file");
+    PerfLog::Timer timer(PerfLog::IO);
+    // Limit the number of outputs in flight to one
+    wait_for_output();
 
     amrex::Vector<int> istep(
         m_sim.mesh().finestLevel() + 1, m_sim.time().time_index());
@@ -189,6 +194,8 @@ void IOManager::write_plot_file()
 void IOManager::write_checkpoint_file(const int start_level, int end_level)
 {
     BL_PROFILE("amr-wind::IOManager::write_checkpoint_file");
+    PerfLog::Timer timer(PerfLog::IO);
+    wait_for_output();
     const std::string level_prefix = "Level_";
     const std::string chkname =
         amrex::Concatenate(m_chk_prefix, m_sim.time().time_index());
@@ -205,17 +212,30 @@ void IOManager::write_checkpoint_file(const int start_level, int end_level)
     write_header(chkname, start_level, end_level);
     write_info_file(chkname);
 
+    const bool use_async = amrex::AsyncOut::UseAsyncOut();
     for (int lev = start_level; lev < end_level + 1; ++lev) {
         for (auto* fld : m_chk_fields) {
             auto& field = *fld;
-            amrex::VisMF::Write(
-                field(lev),
-                amrex::MultiFabFileFullPrefix(
-                    lev - start_level, chkname, level_prefix, field.name()));
+            const auto mf_name = amrex::MultiFabFileFullPrefix(
+                lev - start_level, chkname, level_prefix, field.name());
+            if (use_async) {
+                // The data is copied before this call returns
+                amrex::VisMF::AsyncWrite(field(lev), mf_name);
+            } else {
+                amrex::VisMF::Write(field(lev), mf_name);
+            }
         }
     }
 }
 
+void IOManager::wait_for_output()
+{
+    if (amrex::AsyncOut::UseAsyncOut()) {
+        BL_PROFILE("amr-wind::IOManager::wait_for_output");
+        amrex::AsyncOut::Wait();
+    }
+}
+
 void IOManager::read_checkpoint_fields(
     const std::string& restart_file,
     const amrex::Vector<amrex::BoxArray>& ba_chk,
@@ -0,0 +1,236 @@
+#include "amr-wind/utilities/PerfLog.H"
+#include "amr-wind/utilities/ReductionBatch.H"
+
+#include <fstream>
+#include <iomanip>
+#include <map>
+
+#include "AMReX.H"
+#include "AMReX_Array.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_Vector.H"
+
+namespace amr_wind {
+
+namespace {
+
+struct PerfLogState
+{
+    bool enabled{false};
+
+    //! Log file (I/O processor only)
+    std::ofstream out;
+
+    //! Time spent in each phase during the current step
+    amrex::Array<amrex::Real, PerfLog::NumPhases> times{{0.0}};
+
+    //! Active phases, the innermost last
+    amrex::Vector<PerfLog::Phase> stack;
+
+    //! Start of the current interval of the innermost phase
+    amrex::Real mark{0.0};
+
+    //! Start of the current step
+    amrex::Real step_start{0.0};
+
+    //! MLMG iterations of every solve during the current step
+    std::map<std::string, int> iters;
+};
+
+PerfLogState& state()
+{
+    static PerfLogState s;
+    return s;
+}
+
+void write_stats(
+    std::ostream& out,
+    const std::string& name,
+    const ReductionBatch& batch,
+    const int idx,
+    const int nprocs)
+{
+    // Index of the minimum, maximum, and sum added in end_step
+    out << "\"" << name << "\":{\"min\":" << batch.value(idx)
+        << ",\"avg\":" << batch.value(idx + 2) / nprocs
+        << ",\"max\":" << batch.value(idx + 1) << "}";
+}
+
+} // namespace
+
+PerfLog::Timer::Timer(const Phase phase)
+    : m_phase(phase), m_active(PerfLog::enabled())
+{
+    if (m_active) {
+        PerfLog::start(m_phase);
+    }
+}
+
+PerfLog::Timer::~Timer()
+{
+    if (m_active) {
+        PerfLog::stop(m_phase);
+    }
+}
+
+void PerfLog::initialize(const std::string& directory)
+{
+    auto& s = state();
+    s.enabled = true;
+    s.stack.clear();
+    if (amrex::ParallelDescriptor::IOProcessor() && !s.out.is_open()) {
+        const std::string fname = directory + "/" + file_name;
+        s.out.open(fname.c_str(), std::ios::out | std::ios::app);
+        if (!s.out.good()) {
+            amrex::FileOpenFailed(fname);
+        }
+    }
+}
+
+void PerfLog::finalize()
+{
+    auto& s = state();
+    s.enabled = false;
+    if (s.out.is_open()) {
+        s.out.close();
+    }
+}
+
+bool PerfLog::enabled() { return state().enabled; }
+
+void PerfLog::begin_step()
+{
+    auto& s = state();
+    AMREX_ASSERT(s.stack.empty());
+    s.times.fill(0.0);
+    s.iters.clear();
+    s.step_start = amrex::ParallelDescriptor::second();
+}
+
+void PerfLog::start(const Phase phase)
+{
+    auto& s = state();
+    if (!s.enabled) {
+        return;
+    }
+    const amrex::Real now = amrex::ParallelDescriptor::second();
+    if (!s.stack.empty()) {
+        s.times[s.stack.back()] += now - s.mark;
+    }
+    s.stack.push_back(phase);
+    s.mark = now;
+}
+
+void PerfLog::stop(const Phase phase)
+{
+    auto& s = state();
+    if (!s.enabled) {
+        return;
+    }
+    AMREX_ALWAYS_ASSERT(!s.stack.empty() && (s.stack.back() == phase));
+    const amrex::Real now = amrex::ParallelDescriptor::second();
+    s.times[phase] += now - s.mark;
+    s.stack.pop_back();
+    s.mark = now;
+}
+
+void PerfLog::record_mlmg_iters(const std::string& solve_name, int iters)
+{
+    auto& s = state();
+    if (s.enabled) {
+        s.iters[solve_name] += iters;
+    }
+}
+
+amrex::Real PerfLog::local_time(const Phase phase)
+{
+    return state().times[phase];
+}
+
+const char* PerfLog::phase_name(const Phase phase)
+{
+    switch (phase) {
+    case Regrid:
+        return "regrid";
+    case Advection:
+        return "advection";
+    case Diffusion:
+        return "diffusion";
+    case MACProjection:
+        return "mac_projection";
+    case NodalProjection:
+        return "nodal_projection";
+    case SourceTerms:
+        return "source_terms";
+    case Actuator:
+        return "actuator";
+    case Sampling:
+        return "sampling";
+    case IO:
+        return "io";
+    default:
+        amrex::Abort("PerfLog: invalid phase");
+    }
+    return "";
+}
+
+void PerfLog::end_step(
+    const int step, const amrex::Real time, const amrex::Real dt)
+{
+    auto& s = state();
+    if (!s.enabled) {
+        return;
+    }
+    AMREX_ALWAYS_ASSERT(s.stack.empty());
+
+    const amrex::Real total =
+        amrex::ParallelDescriptor::second() - s.step_start;
+    amrex::Real other = total;
+    for (const auto t : s.times) {
+        other -= t;
+    }
+
+    // Minimum, maximum, and sum of every timer in a single batch
+    ReductionBatch batch;
+    amrex::Vector<std::string> names;
+    amrex::Vector<int> indices;
+    const auto add_timer = [&](const std::string& name, const amrex::Real t) {
+        names.push_back(name);
+        indices.push_back(batch.min(name + ":min", t));
+        batch.max(name + ":max", t);
+        batch.sum(name + ":sum", t);
+    };
+    add_timer("total", total);
+    for (int i = 0; i < NumPhases; ++i) {
+        add_timer(phase_name(static_cast<Phase>(i)), s.times[i]);
+    }
+    add_timer("other", other);
+    batch.reduce();
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        const int nprocs = amrex::ParallelDescriptor::NProcs();
+        auto& out = s.out;
+        out << std::setprecision(12) << "{\"step\":" << step
+            << ",\"time\":" << time << ",\"dt\":" << dt
+            << ",\"nprocs\":" << nprocs << ",\"wall_time\":{"
+            << std::setprecision(6);
+        for (int i = 0; i < names.size(); ++i) {
+            if (i > 0) {
+                out << ",";
+            }
+            write_stats(out, names[i], batch, indices[i], nprocs);
+        }
+        out << "},\"mlmg_iters\":{";
+        bool first = true;
+        for (const auto& it : s.iters) {
+            if (!first) {
+                out << ",";
+            }
+            out << "\"" << it.first << "\":" << it.second;
+            first = false;
+        }
+        out << "}}" << std::endl;
+    }
+}
+
+} // namespace amr_wind
@@ -0,0 +1,393 @@
+#include "amr-wind/utilities/PlaneAveragingBatch.H"
+
+#include <algorithm>
+#include <limits>
+
+namespace amr_wind {
+
+void PlaneAveragingBatch::add(FieldPlaneAveraging& pa)
+{
+    for (const auto& info : m_plane_averages) {
+        if (info.pa == &pa) {
+            return;
+        }
+    }
+
+    if (m_plane_averages.empty()) {
+        m_axis = pa.axis();
+        m_ncell_line = pa.ncell_line();
+        m_ncell_plane = pa.ncell_plane();
+    }
+    AMREX_ALWAYS_ASSERT(pa.axis() == m_axis);
+    AMREX_ALWAYS_ASSERT(pa.level() == 0);
+    AMREX_ALWAYS_ASSERT(pa.ncell_line() == m_ncell_line);
+    AMREX_ALWAYS_ASSERT(pa.ncell_plane() == m_ncell_plane);
+
+    const int field = field_index(pa);
+    PlaneAverageInfo info{&pa, static_cast<int>(m_vars.size()), nullptr, -1};
+    for (int n = 0; n < pa.ncomp(); ++n) {
+        m_vars.push_back(Var{field, n, -1});
+    }
+
+    auto* vel_pa = dynamic_cast<VelPlaneAveraging*>(&pa);
+    if (vel_pa != nullptr) {
+        const int h1 = (m_axis == 0) ? 1 : 0;
+        const int h2 = (m_axis == 2) ? 1 : 2;
+        info.vel_pa = vel_pa;
+        info.hvelmag_var = static_cast<int>(m_vars.size());
+        m_vars.push_back(Var{field, h1, h2});
+    }
+    AMREX_ALWAYS_ASSERT(static_cast<int>(m_vars.size()) <= max_vars);
+
+    m_plane_averages.push_back(info);
+    m_shift.assign(static_cast<size_t>(m_ncell_line) * m_vars.size(), 0.0);
+    m_device_data_valid = false;
+}
+
+void PlaneAveragingBatch::add(SecondMomentAveraging& sm)
+{
+    auto& pa1 = sm.m_plane_average1;
+    auto& pa2 = sm.m_plane_average2;
+    add(pa1);
+    add(pa2);
+
+    amrex::Vector<int> terms;
+    for (int m = 0; m < pa1.ncomp(); ++m) {
+        for (int n = 0; n < pa2.ncomp(); ++n) {
+            terms.push_back(
+                term_index({var_index(pa1, m), var_index(pa2, n), -1}));
+        }
+    }
+    m_second_moments.emplace_back(&sm, std::move(terms));
+}
+
+void PlaneAveragingBatch::add(ThirdMomentAveraging& tm)
+{
+    auto& pa1 = tm.m_plane_average1;
+    auto& pa2 = tm.m_plane_average2;
+    auto& pa3 = tm.m_plane_average3;
+    add(pa1);
+    add(pa2);
+    add(pa3);
+
+    amrex::Vector<int> terms;
+    for (int m = 0; m < pa1.ncomp(); ++m) {
+        for (int n = 0; n < pa2.ncomp(); ++n) {
+            for (int p = 0; p < pa3.ncomp(); ++p) {
+                terms.push_back(term_index(
+                    {var_index(pa1, m), var_index(pa2, n),
+                     var_index(pa3, p)}));
+            }
+        }
+    }
+    m_third_moments.emplace_back(&tm, std::move(terms));
+}
+
+int PlaneAveragingBatch::field_index(const FieldPlaneAveraging& pa)
+{
+    const auto* field = &pa.field();
+    auto found = std::find(m_fields.begin(), m_fields.end(), field);
+    if (found != m_fields.end()) {
+        return static_cast<int>(found - m_fields.begin());
+    }
+    AMREX_ALWAYS_ASSERT(static_cast<int>(m_fields.size()) < max_fields);
+    m_fields.push_back(field);
+    return static_cast<int>(m_fields.size()) - 1;
+}
+
+int PlaneAveragingBatch::var_index(
+    const FieldPlaneAveraging& pa, const int comp) const
+{
+    for (const auto& info : m_plane_averages) {
+        if (info.pa == &pa) {
+            return info.var_start + comp;
+        }
+    }
+    amrex::Abort("PlaneAveragingBatch: plane average is not registered");
+    return -1;
+}
+
+int PlaneAveragingBatch::term_index(Term term)
+{
+    // Products are commutative, sort the factors with unused ones last
+    std::sort(term.begin(), term.end(), [](const int a, const int b) {
+        const int ka = (a < 0) ? std::numeric_limits<int>::max() : a;
+        const int kb = (b < 0) ? std::numeric_limits<int>::max() : b;
+        return ka < kb;
+    });
+
+    auto found = m_term_map.find(term);
+    if (found != m_term_map.end()) {
+        return found->second;
+    }
+
+    // Third moments require the raw second moments of each pair of factors
+    Term pairs{{-1, -1, -1}};
+    if (term[2] >= 0) {
+        pairs[0] = term_index({term[1], term[2], -1});
+        pairs[1] = term_index({term[0], term[2], -1});
+        pairs[2] = term_index({term[0], term[1], -1});
+    }
+
+    const int idx = static_cast<int>(m_terms.size());
+    m_terms.push_back(term);
+    m_pair_terms.push_back(pairs);
+    m_term_map[term] = idx;
+    m_device_data_valid = false;
+    return idx;
+}
+
+void PlaneAveragingBatch::update_device_data()
+{
+    amrex::Vector<int> terms;
+    terms.reserve(m_terms.size() * 3);
+    for (const auto& term : m_terms) {
+        terms.insert(terms.end(), term.begin(), term.end());
+    }
+
+    m_vars_d.resize(m_vars.size());
+    m_terms_d.resize(terms.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, m_vars.begin(), m_vars.end(),
+        m_vars_d.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, terms.begin(), terms.end(),
+        m_terms_d.begin());
+    m_device_data_valid = true;
+}
+
+void PlaneAveragingBatch::operator()(const bool with_moments)
+{
+    BL_PROFILE("amr-wind::PlaneAveragingBatch::operator");
+
+    if (m_plane_averages.empty()) {
+        return;
+    }
+    if (!m_device_data_valid) {
+        update_device_data();
+    }
+
+    const int nterms = with_moments ? static_cast<int>(m_terms.size()) : 0;
+    switch (m_axis) {
+    case 0:
+        compute_sums(XDir(), nterms);
+        break;
+    case 1:
+        compute_sums(YDir(), nterms);
+        break;
+    case 2:
+        compute_sums(ZDir(), nterms);
+        break;
+    default:
+        amrex::Abort("axis must be equal to 0, 1, or 2");
+        break;
+    }
+
+    amrex::Vector<amrex::Real> moments;
+    if (with_moments) {
+        compute_moments(moments, nterms);
+    }
+    update_averages(nterms);
+    if (with_moments) {
+        update_moments(moments);
+    }
+}
+
+template <typename IndexSelector>
+void PlaneAveragingBatch::compute_sums(
+    const IndexSelector& idx_op, const int nterms)
+{
+    BL_PROFILE("amr-wind::PlaneAveragingBatch::compute_sums");
+
+    const int level = 0;
+    const int nfields = static_cast<int>(m_fields.size());
+    const int nvars = static_cast<int>(m_vars.size());
+    const int nsums = nvars + nterms;
+
+    const auto& mfab0 = (*m_fields[0])(level);
+    amrex::Vector<const amrex::MultiFab*> mfabs(nfields);
+    for (int n = 0; n < nfields; ++n) {
+        mfabs[n] = &(*m_fields[n])(level);
+        AMREX_ALWAYS_ASSERT(mfabs[n]->boxArray() == mfab0.boxArray());
+        AMREX_ALWAYS_ASSERT(
+            mfabs[n]->DistributionMap() == mfab0.DistributionMap());
+    }
+
+    m_sums.assign(static_cast<size_t>(m_ncell_line) * nsums, 0.0);
+    amrex::AsyncArray<amrex::Real> lsums(m_sums.data(), m_sums.size());
+    amrex::AsyncArray<amrex::Real> lshift(m_shift.data(), m_shift.size());
+    amrex::Real* line_sums = lsums.data();
+    const amrex::Real* line_shift = lshift.data();
+    const auto* vars = m_vars_d.data();
+    const int* terms = m_terms_d.data();
+
+    const amrex::Real denom = 1.0 / (amrex::Real)m_ncell_plane;
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
+#endif
+    for (amrex::MFIter mfi(mfab0, amrex::TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+        amrex::Box bx = mfi.tilebox();
+
+        amrex::GpuArray<amrex::Array4<const amrex::Real>, max_fields> fab_arrs;
+        for (int n = 0; n < nfields; ++n) {
+            fab_arrs[n] = mfabs[n]->const_array(mfi);
+        }
+
+        amrex::Box pbx =
+            perpendicular_box<IndexSelector>(bx, amrex::IntVect{0, 0, 0});
+
+        amrex::ParallelFor(
+            amrex::Gpu::KernelInfo().setReduction(true), pbx,
+            [=] AMREX_GPU_DEVICE(
+                int p_i, int p_j, int p_k,
+                amrex::Gpu::Handler const& handler) noexcept {
+                // Loop over the direction perpendicular to the plane.
+                // This reduces the atomic pressure on the destination arrays.
+
+                amrex::Box lbx = parallel_box<IndexSelector>(
+                    bx, amrex::IntVect{p_i, p_j, p_k});
+
+                for (int k = lbx.smallEnd(2); k <= lbx.bigEnd(2); ++k) {
+                    for (int j = lbx.smallEnd(1); j <= lbx.bigEnd(1); ++j) {
+                        for (int i = lbx.smallEnd(0); i <= lbx.bigEnd(0); ++i) {
+
+                            const int ind = idx_op(i, j, k);
+
+                            amrex::Real q[max_vars];
+                            for (int v = 0; v < nvars; ++v) {
+                                const auto& var = vars[v];
+                                const auto& farr = fab_arrs[var.field];
+                                amrex::Real val = farr(i, j, k, var.comp);
+                                if (var.comp2 >= 0) {
+                                    const amrex::Real val2 =
+                                        farr(i, j, k, var.comp2);
+                                    val = std::sqrt(val * val + val2 * val2);
+                                }
+                                q[v] = val - line_shift[nvars * ind + v];
+                                amrex::Gpu::deviceReduceSum(
+                                    &line_sums[nsums * ind + v], q[v] * denom,
+                                    handler);
+                            }
+
+                            for (int t = 0; t < nterms; ++t) {
+                                const int* tm = &terms[3 * t];
+                                amrex::Real prod = q[tm[0]] * q[tm[1]];
+                                if (tm[2] >= 0) {
+                                    prod *= q[tm[2]];
+                                }
+                                amrex::Gpu::deviceReduceSum(
+                                    &line_sums[nsums * ind + nvars + t],
+                                    prod * denom, handler);
+                            }
+                        }
+                    }
+                }
+            });
+    }
+
+    lsums.copyToHost(m_sums.data(), m_sums.size());
+    amrex::ParallelDescriptor::ReduceRealSum(
+        m_sums.data(), static_cast<int>(m_sums.size()));
+}
+
+void PlaneAveragingBatch::compute_moments(
+    amrex::Vector<amrex::Real>& moments, const int nterms) const
+{
+    const int nvars = static_cast<int>(m_vars.size());
+    const int nsums = nvars + nterms;
+    moments.resize(static_cast<size_t>(m_ncell_line) * nterms);
+
+    for (int ind = 0; ind < m_ncell_line; ++ind) {
+        // Averages of the shifted quantities and of their products
+        const amrex::Real* avg = &m_sums[nsums * ind];
+        const amrex::Real* raw = avg + nvars;
+        amrex::Real* cm = &moments[nterms * ind];
+
+        for (int t = 0; t < nterms; ++t) {
+            const auto& tm = m_terms[t];
+            const amrex::Real a = avg[tm[0]];
+            const amrex::Real b = avg[tm[1]];
+            if (tm[2] < 0) {
+                cm[t] = raw[t] - a * b;
+            } else {
+                const auto& pairs = m_pair_terms[t];
+                const amrex::Real c = avg[tm[2]];
+                cm[t] = raw[t] - a * raw[pairs[0]] - b * raw[pairs[1]] -
+                        c * raw[pairs[2]] + 2.0 * a * b * c;
+            }
+        }
+    }
+}
+
+void PlaneAveragingBatch::update_averages(const int nterms)
+{
+    const int nvars = static_cast<int>(m_vars.size());
+    const int nsums = nvars + nterms;
+    for (int ind = 0; ind < m_ncell_line; ++ind) {
+        for (int v = 0; v < nvars; ++v) {
+            m_shift[nvars * ind + v] += m_sums[nsums * ind + v];
+        }
+    }
+
+    for (const auto& info : m_plane_averages) {
+        auto& pa = *info.pa;
+        const int ncomp = pa.ncomp();
+        for (int ind = 0; ind < m_ncell_line; ++ind) {
+            for (int n = 0; n < ncomp; ++n) {
+                pa.m_line_average[ncomp * ind + n] =
+                    m_shift[nvars * ind + info.var_start + n];
+            }
+        }
+        pa.m_last_updated_index = pa.m_time.time_index();
+        if (pa.m_comp_deriv) {
+            pa.compute_line_derivatives();
+        }
+
+        if (info.vel_pa != nullptr) {
+            auto& vel_pa = *info.vel_pa;
+            for (int ind = 0; ind < m_ncell_line; ++ind) {
+                vel_pa.m_line_hvelmag_average[ind] =
+                    m_shift[nvars * ind + info.hvelmag_var];
+            }
+            if (!vel_pa.m_line_hvelmag_deriv.empty()) {
+                vel_pa.compute_line_hvelmag_derivatives();
+            }
+        }
+    }
+}
+
+void PlaneAveragingBatch::update_moments(
+    const amrex::Vector<amrex::Real>& moments)
+{
+    const int nterms = static_cast<int>(m_terms.size());
+
+    for (const auto& item : m_second_moments) {
+        auto& sm = *item.first;
+        const auto& terms = item.second;
+        const int nmoments = static_cast<int>(terms.size());
+        for (int ind = 0; ind < m_ncell_line; ++ind) {
+            for (int n = 0; n < nmoments; ++n) {
+                sm.m_second_moments_line[nmoments * ind + n] =
+                    moments[nterms * ind + terms[n]];
+            }
+        }
+        sm.m_last_updated_index = sm.m_plane_average1.last_updated_index();
+    }
+
+    for (const auto& item : m_third_moments) {
+        auto& tm = *item.first;
+        const auto& terms = item.second;
+        const int nmoments = static_cast<int>(terms.size());
+        for (int ind = 0; ind < m_ncell_line; ++ind) {
+            for (int n = 0; n < nmoments; ++n) {
+                tm.m_third_moments_line[nmoments * ind + n] =
+                    moments[nterms * ind + terms[n]];
+            }
+        }
+        tm.m_last_updated_index = tm.m_plane_average1.last_updated_index();
+    }
+}
+
+} // namespace amr_wind
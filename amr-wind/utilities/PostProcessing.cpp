@@ -1,6 +1,7 @@
 #include "amr-wind/utilities/PostProcessing.H"
 #include "amr-wind/CFDSim.H"
 #include "amr-wind/utilities/averaging/TimeAveraging.H"
+#include "amr-wind/utilities/PerfLog.H"
 
 #include "AMReX_ParmParse.H"
 
@@ -67,6 +68,7 @@ void PostProcessManager::post_init_actions()
 
 void PostProcessManager::post_advance_work()
 {
+    PerfLog::Timer timer(PerfLog::Sampling);
     // Get minimum tolerance
     auto tol = m_sim.time().get_minimum_enforce_dt_abs_tol();
     for (auto& post : m_post) {
@@ -0,0 +1,121 @@
+#include "amr-wind/utilities/ReductionBatch.H"
+
+#include "AMReX.H"
+#include "AMReX_Algorithm.H"
+#include "AMReX_BLProfiler.H"
+#include "AMReX_ParallelContext.H"
+#include "AMReX_ParallelReduce.H"
+
+namespace amr_wind {
+
+int ReductionBatch::max(const std::string& name, const amrex::Real val)
+{
+    return add(name, Op::Max, val);
+}
+
+int ReductionBatch::min(const std::string& name, const amrex::Real val)
+{
+    return add(name, Op::Min, val);
+}
+
+int ReductionBatch::sum(const std::string& name, const amrex::Real val)
+{
+    return add(name, Op::Sum, val);
+}
+
+int ReductionBatch::add(
+    const std::string& name, const Op op, const amrex::Real val)
+{
+    auto found = m_index.find(name);
+    if (found == m_index.end()) {
+        const int idx = size();
+        m_index[name] = idx;
+        m_ops.push_back(op);
+        m_values.push_back(val);
+        return idx;
+    }
+
+    const int idx = found->second;
+    if (m_ops[idx] != op) {
+        amrex::Abort(
+            "ReductionBatch: inconsistent reduction operations for " + name);
+    }
+    switch (op) {
+    case Op::Max:
+        m_values[idx] = amrex::max(m_values[idx], val);
+        break;
+    case Op::Min:
+        m_values[idx] = amrex::min(m_values[idx], val);
+        break;
+    case Op::Sum:
+        m_values[idx] += val;
+        break;
+    }
+    return idx;
+}
+
+void ReductionBatch::reduce()
+{
+    BL_PROFILE("amr-wind::ReductionBatch::reduce");
+
+    // Maxima and negated minima are reduced together
+    amrex::Vector<amrex::Real> extrema;
+    amrex::Vector<amrex::Real> sums;
+    for (int i = 0; i < size(); ++i) {
+        switch (m_ops[i]) {
+        case Op::Max:
+            extrema.push_back(m_values[i]);
+            break;
+        case Op::Min:
+            extrema.push_back(-m_values[i]);
+            break;
+        case Op::Sum:
+            sums.push_back(m_values[i]);
+            break;
+        }
+    }
+
+    const auto comm = amrex::ParallelContext::CommunicatorSub();
+    if (!extrema.empty()) {
+        amrex::ParallelAllReduce::Max<amrex::Real>(
+            extrema.data(), static_cast<int>(extrema.size()), comm);
+    }
+    if (!sums.empty()) {
+        amrex::ParallelAllReduce::Sum<amrex::Real>(
+            sums.data(), static_cast<int>(sums.size()), comm);
+    }
+
+    int iext = 0;
+    int isum = 0;
+    for (int i = 0; i < size(); ++i) {
+        switch (m_ops[i]) {
+        case Op::Max:
+            m_values[i] = extrema[iext++];
+            break;
+        case Op::Min:
+            m_values[i] = -extrema[iext++];
+            break;
+        case Op::Sum:
+            m_values[i] = sums[isum++];
+            break;
+        }
+    }
+}
+
+amrex::Real ReductionBatch::value(const std::string& name) const
+{
+    const auto found = m_index.find(name);
+    if (found == m_index.end()) {
+        amrex::Abort("ReductionBatch: unknown quantity " + name);
+    }
+    return m_values[found->second];
+}
+
+void ReductionBatch::clear()
+{
+    m_index.clear();
+    m_ops.clear();
+    m_values.clear();
+}
+
+} // namespace amr_wind
@@ -2,6 +2,7 @@
 #include <ctime>
 #include "amr-wind/utilities/console_io.H"
 #include "amr-wind/AMRWindVersion.H"
+#include "amr-wind/utilities/PerfLog.H"
 #include "AMReX.H"
 #include "AMReX_OpenMP.H"
 #include "amr-wind/CFDSim.H"
@@ -177,6 +178,8 @@ void print_mlmg_header(const std::string& key)
 
 void print_mlmg_info(const std::string& solve_name, const amrex::MLMG& mlmg)
 {
+    PerfLog::record_mlmg_iters(solve_name, mlmg.getNumIters());
+
     const int name_width = 26;
     amrex::Print() << "  " << std::setw(name_width) << std::left << solve_name
                    << std::setw(6) << std::right << mlmg.getNumIters()
@@ -1,27 +1,131 @@
 #include "amr-wind/incflo.H"
 #include "diagnostics.H"
 #include "constants.H"
+#include "amr-wind/utilities/ReductionBatch.H"
 
 using namespace amrex;
 
-void amr_wind::diagnostics::make_mask_addend(
-    amrex::MultiFab& mfab,
-    const amrex::MultiFab& mfab_mask,
-    const amrex::Real mask_val,
-    const amrex::Real set_val)
+namespace {
+
+using RealTypes6 = amrex::TypeList<
+    amrex::Real,
+    amrex::Real,
+    amrex::Real,
+    amrex::Real,
+    amrex::Real,
+    amrex::Real>;
+using RealTuple6 = amrex::GpuTuple<
+    amrex::Real,
+    amrex::Real,
+    amrex::Real,
+    amrex::Real,
+    amrex::Real,
+    amrex::Real>;
+using MaxOps6 = amrex::TypeList<
+    amrex::ReduceOpMax,
+    amrex::ReduceOpMax,
+    amrex::ReduceOpMax,
+    amrex::ReduceOpMax,
+    amrex::ReduceOpMax,
+    amrex::ReduceOpMax>;
+using MaxMinOps6 = amrex::TypeList<
+    amrex::ReduceOpMax,
+    amrex::ReduceOpMin,
+    amrex::ReduceOpMax,
+    amrex::ReduceOpMin,
+    amrex::ReduceOpMax,
+    amrex::ReduceOpMin>;
+
+amrex::Array<amrex::Real, 6> to_array(const RealTuple6& tup)
 {
-    const auto& arr = mfab.arrays();
-    const auto& arr_mask = mfab_mask.const_arrays();
-    amrex::ParallelFor(
-        mfab, mfab.n_grow, mfab.n_comp,
-        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
-            arr[nbx](i, j, k, n) = std::abs(arr_mask[nbx](i, j, k) - mask_val) <
-                                           constants::TIGHT_TOL
-                                       ? 0.0
-                                       : set_val;
-        });
+    return {amrex::get<0>(tup), amrex::get<1>(tup), amrex::get<2>(tup),
+            amrex::get<3>(tup), amrex::get<4>(tup), amrex::get<5>(tup)};
+}
+
+//! Name of the maximum or minimum of a velocity component
+std::string extremum_name(const int vdir, const bool is_max)
+{
+    const std::string comp{"uvw"[vdir]};
+    return comp + (is_max ? "_max" : "_min");
+}
+
+//! Name of a coordinate of the location of an extremum
+std::string location_name(const int vdir, const bool is_max, const int ldir)
+{
+    const std::string coord{"xyz"[ldir]};
+    return extremum_name(vdir, is_max) + "_" + coord;
+}
+
+//! Locations default to the lower corner of the domain
+void add_default_locations(
+    amr_wind::ReductionBatch& locations,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& problo)
+{
+    for (int n = 0; n < 3; ++n) {
+        for (int d = 0; d < 3; ++d) {
+            locations.max(location_name(n, true, d), problo[d]);
+            locations.max(location_name(n, false, d), problo[d]);
+        }
+    }
 }
 
+//! Add the locations of the maximum and minimum of a velocity component
+void add_locations(
+    amr_wind::ReductionBatch& locations,
+    const int vdir,
+    const amrex::Array<amrex::Real, 6>& locs)
+{
+    for (int d = 0; d < 3; ++d) {
+        locations.max(location_name(vdir, true, d), locs[d]);
+        locations.max(location_name(vdir, false, d), locs[3 + d]);
+    }
+}
+
+//! Print the extrema and their locations, return them (for testing)
+amrex::Array<amrex::Real, 24> print_extrema(
+    const std::string& title,
+    const std::string& header,
+    const amr_wind::ReductionBatch& extrema,
+    const amr_wind::ReductionBatch& locations)
+{
+    amrex::Print() << "\n"
+                   << title << header << std::endl
+                   << "........................................................"
+                      "......................"
+                   << std::endl;
+
+    amrex::Array<amrex::Real, 24> result;
+    for (int n = 0; n < 3; ++n) {
+        for (const bool is_max : {true, false}) {
+            const int offset = 8 * n + (is_max ? 0 : 4);
+            result[offset] = extrema.value(extremum_name(n, is_max));
+            for (int d = 0; d < 3; ++d) {
+                result[offset + 1 + d] =
+                    locations.value(location_name(n, is_max, d));
+            }
+
+            amrex::Print() << (is_max ? "Max " : "Min ") << "uvw"[n] << ": "
+                           << std::setw(20) << std::right << result[offset];
+            amrex::Print() << " |  Location (x,y,z): ";
+            amrex::Print() << std::setw(10) << std::right << result[offset + 1]
+                           << ", ";
+            amrex::Print() << std::setw(10) << std::right << result[offset + 2]
+                           << ", ";
+            amrex::Print() << std::setw(10) << std::right << result[offset + 3]
+                           << std::endl;
+        }
+    }
+
+    amrex::Print() << "........................................................"
+                      "......................"
+                   << std::endl
+                   << std::endl;
+
+    return result;
+}
+
+} // namespace
+
 void amr_wind::diagnostics::get_field_extrema(
     amrex::Real& field_max_val,
     amrex::Real& field_min_val,
@@ -32,21 +136,33 @@ void amr_wind::diagnostics::get_field_extrema(
 {
     const int finest_level = field.repo().num_active_levels() - 1;
 
-    amrex::Real max_val_lev{constants::LOW_NUM};
-    amrex::Real min_val_lev{constants::LARGE_NUM};
-    field_max_val = max_val_lev;
-    field_min_val = min_val_lev;
+    // All levels and components are reduced in a single collective call
+    ReductionBatch extrema;
+    extrema.max("max", constants::LOW_NUM);
+    extrema.min("min", constants::LARGE_NUM);
     for (int lev = 0; lev <= finest_level; lev++) {
-        for (int n = comp; n < comp + ncomp; ++n) {
-            max_val_lev = field(lev).max(n, nghost);
-            min_val_lev = field(lev).min(n, nghost);
-            field_min_val = amrex::min(field_min_val, min_val_lev);
-            field_max_val = amrex::max(field_max_val, max_val_lev);
-        }
+        const auto& farr = field(lev).const_arrays();
+        const auto ext = amrex::ParReduce(
+            amrex::TypeList<amrex::ReduceOpMax, amrex::ReduceOpMin>{},
+            amrex::TypeList<amrex::Real, amrex::Real>{}, field(lev),
+            amrex::IntVect(nghost),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k)
+                -> amrex::GpuTuple<amrex::Real, amrex::Real> {
+                amrex::Real fmax = constants::LOW_NUM;
+                amrex::Real fmin = constants::LARGE_NUM;
+                for (int n = comp; n < comp + ncomp; ++n) {
+                    fmax = amrex::max(fmax, farr[nbx](i, j, k, n));
+                    fmin = amrex::min(fmin, farr[nbx](i, j, k, n));
+                }
+                return {fmax, fmin};
+            });
+        extrema.max("max", amrex::get<0>(ext));
+        extrema.min("min", amrex::get<1>(ext));
     }
+    extrema.reduce();
 
-    amrex::ParallelDescriptor::ReduceRealMax(field_max_val);
-    amrex::ParallelDescriptor::ReduceRealMin(field_min_val);
+    field_max_val = extrema.value("max");
+    field_min_val = extrema.value("min");
 }
 
 bool amr_wind::diagnostics::get_field_extrema(
@@ -62,191 +178,161 @@ bool amr_wind::diagnostics::get_field_extrema(
 {
     const int finest_level = field.repo().num_active_levels() - 1;
 
-    amrex::Real max_val_lev{constants::LOW_NUM};
-    amrex::Real min_val_lev{constants::LARGE_NUM};
-    amrex::Real min_mask_lev = min_val_lev;
-    amrex::Real mask_min = min_mask_lev;
-    field_max_val = max_val_lev;
-    field_min_val = min_val_lev;
+    // All levels and components are reduced in a single collective call,
+    // together with the flag indicating whether the mask value was found
+    ReductionBatch extrema;
+    extrema.max("max", constants::LOW_NUM);
+    extrema.min("min", constants::LARGE_NUM);
+    extrema.max("found", 0.0);
     for (int lev = 0; lev <= finest_level; lev++) {
-        amrex::MultiFab mask_addend_max(
-            field_mask(lev).boxArray(), field_mask(lev).DistributionMap(),
-            ncomp, nghost);
-        amrex::MultiFab mask_addend_min(
-            field_mask(lev).boxArray(), field_mask(lev).DistributionMap(),
-            ncomp, nghost);
-        amr_wind::diagnostics::make_mask_addend(
-            mask_addend_max, field_mask(lev), mask_val, constants::LOW_NUM);
-        amr_wind::diagnostics::make_mask_addend(
-            mask_addend_min, field_mask(lev), mask_val, constants::LARGE_NUM);
-        min_mask_lev = mask_addend_min.min(0, nghost);
-        mask_min = amrex::min(mask_min, min_mask_lev);
-        amrex::MultiFab::Add(
-            mask_addend_max, field(lev), comp, 0, ncomp, nghost);
-        amrex::MultiFab::Add(
-            mask_addend_min, field(lev), comp, 0, ncomp, nghost);
-        for (int n = 0; n < ncomp; ++n) {
-            max_val_lev = mask_addend_max.max(n, nghost);
-            min_val_lev = mask_addend_min.min(n, nghost);
-            field_min_val = amrex::min(field_min_val, min_val_lev);
-            field_max_val = amrex::max(field_max_val, max_val_lev);
-        }
+        const auto& farr = field(lev).const_arrays();
+        const auto& mask_arr = field_mask(lev).const_arrays();
+        const auto ext = amrex::ParReduce(
+            amrex::TypeList<
+                amrex::ReduceOpMax, amrex::ReduceOpMin, amrex::ReduceOpMax>{},
+            amrex::TypeList<amrex::Real, amrex::Real, amrex::Real>{},
+            field(lev), amrex::IntVect(nghost),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k)
+                -> amrex::GpuTuple<amrex::Real, amrex::Real, amrex::Real> {
+                amrex::Real fmax = constants::LOW_NUM;
+                amrex::Real fmin = constants::LARGE_NUM;
+                const bool found = std::abs(mask_arr[nbx](i, j, k) - mask_val) <
+                                   constants::TIGHT_TOL;
+                if (found) {
+                    for (int n = comp; n < comp + ncomp; ++n) {
+                        fmax = amrex::max(fmax, farr[nbx](i, j, k, n));
+                        fmin = amrex::min(fmin, farr[nbx](i, j, k, n));
+                    }
+                }
+                return {fmax, fmin, found ? 1.0 : 0.0};
+            });
+        extrema.max("max", amrex::get<0>(ext));
+        extrema.min("min", amrex::get<1>(ext));
+        extrema.max("found", amrex::get<2>(ext));
     }
+    extrema.reduce();
 
-    amrex::ParallelDescriptor::ReduceRealMax(field_max_val);
-    amrex::ParallelDescriptor::ReduceRealMin(field_min_val);
-    amrex::ParallelDescriptor::ReduceRealMax(mask_min);
-
-    const bool found_mask_val = (mask_min < constants::TIGHT_TOL);
-    return found_mask_val;
+    field_max_val = extrema.value("max");
+    field_min_val = extrema.value("min");
+    return (extrema.value("found") > 0.0);
 }
 
-amrex::Real amr_wind::diagnostics::get_vel_max(
-    const amrex::MultiFab& vel,
-    const amrex::iMultiFab& level_mask,
-    const int vdir,
-    const amrex::Real factor)
+amrex::Array<amrex::Real, 6> amr_wind::diagnostics::get_vel_extrema(
+    const amrex::MultiFab& vel, const amrex::iMultiFab& level_mask)
 {
-    return amrex::ReduceMax(
-        vel, level_mask, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx,
-            amrex::Array4<amrex::Real const> const& vel_arr,
-            amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-            amrex::Real max_fab = -1e8;
-            amrex::Loop(bx, [=, &max_fab](int i, int j, int k) noexcept {
-                max_fab = amrex::max(
-                    max_fab, mask_arr(i, j, k) > 0
-                                 ? factor * vel_arr(i, j, k, vdir)
-                                 : std::numeric_limits<amrex::Real>::lowest());
-            });
-            return max_fab;
+    const auto& vel_arr = vel.const_arrays();
+    const auto& mask_arr = level_mask.const_arrays();
+    const auto ext = amrex::ParReduce(
+        MaxMinOps6{}, RealTypes6{}, vel, amrex::IntVect(0),
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) -> RealTuple6 {
+            const amrex::Real low = std::numeric_limits<amrex::Real>::lowest();
+            const amrex::Real high = std::numeric_limits<amrex::Real>::max();
+            const auto& v = vel_arr[nbx];
+            const bool mask_check = (mask_arr[nbx](i, j, k) > 0);
+            return {
+                mask_check ? v(i, j, k, 0) : low,
+                mask_check ? v(i, j, k, 0) : high,
+                mask_check ? v(i, j, k, 1) : low,
+                mask_check ? v(i, j, k, 1) : high,
+                mask_check ? v(i, j, k, 2) : low,
+                mask_check ? v(i, j, k, 2) : high};
         });
+    return to_array(ext);
 }
 
-amrex::Real amr_wind::diagnostics::get_vel_max(
-    const amrex::MultiFab& vel,
-    const amrex::iMultiFab& level_mask,
-    const int vdir)
-{
-    return get_vel_max(vel, level_mask, vdir, 1.0);
-}
-
-amrex::Real amr_wind::diagnostics::get_vel_min(
-    const amrex::MultiFab& vel,
-    const amrex::iMultiFab& level_mask,
-    const int vdir)
-{
-    return get_vel_max(vel, level_mask, vdir, -1.0);
-}
-
-amrex::Real amr_wind::diagnostics::get_vel_loc(
+amrex::Array<amrex::Real, 6> amr_wind::diagnostics::get_vel_extrema_loc(
     const amrex::MultiFab& vel,
     const amrex::iMultiFab& level_mask,
     const int vdir,
-    const int ldir,
-    amrex::Real vel_max,
+    const amrex::Real vel_max,
+    const amrex::Real vel_min,
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> problo,
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx)
 {
-
-    return amrex::ReduceMax(
-        vel, level_mask, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx,
-            amrex::Array4<amrex::Real const> const& vel_arr,
-            amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-            amrex::Real loc_fab = problo[ldir];
-            amrex::Loop(bx, [=, &loc_fab](int i, int j, int k) noexcept {
-                int idx = (ldir == 0 ? i : (ldir == 1 ? j : k));
-                amrex::Real offset = 0.5;
-                amrex::Real loc = problo[ldir] + (idx + offset) * dx[ldir];
-                bool mask_check = (mask_arr(i, j, k) > 0);
-                bool loc_check =
-                    (amrex::Math::abs(vel_max - vel_arr(i, j, k, vdir)) <
-                     1e-10);
-                loc_fab = amrex::max(
-                    loc_fab, (mask_check && loc_check ? loc : problo[ldir]));
-            });
-            return loc_fab;
+    const auto& vel_arr = vel.const_arrays();
+    const auto& mask_arr = level_mask.const_arrays();
+    const auto locs = amrex::ParReduce(
+        MaxOps6{}, RealTypes6{}, vel, amrex::IntVect(0),
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) -> RealTuple6 {
+            const amrex::Real val = vel_arr[nbx](i, j, k, vdir);
+            const bool mask_check = (mask_arr[nbx](i, j, k) > 0);
+            const bool max_check =
+                mask_check && (amrex::Math::abs(vel_max - val) < 1e-10);
+            const bool min_check =
+                mask_check && (amrex::Math::abs(vel_min - val) < 1e-10);
+            const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+            const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+            const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+            return {
+                max_check ? x : problo[0], max_check ? y : problo[1],
+                max_check ? z : problo[2], min_check ? x : problo[0],
+                min_check ? y : problo[1], min_check ? z : problo[2]};
         });
+    return to_array(locs);
 }
 
-amrex::Real amr_wind::diagnostics::get_macvel_max(
-    const amrex::MultiFab& macvel,
-    const amrex::iMultiFab& level_mask,
-    const int vdir,
-    const amrex::Real factor)
-{
-    return amrex::ReduceMax(
-        macvel, level_mask, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx,
-            amrex::Array4<amrex::Real const> const& mvel_arr,
-            amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-            amrex::Real max_fab = -1e8;
-            amrex::Loop(bx, [=, &max_fab](int i, int j, int k) noexcept {
-                int ii = i - (vdir == 0 ? 1 : 0);
-                int jj = j - (vdir == 1 ? 1 : 0);
-                int kk = k - (vdir == 2 ? 1 : 0);
-                max_fab = amrex::max(
-                    max_fab, (mask_arr(i, j, k) + mask_arr(ii, jj, kk)) > 0
-                                 ? factor * mvel_arr(i, j, k)
-                                 : std::numeric_limits<amrex::Real>::lowest());
-            });
-            return max_fab;
-        });
-}
-
-amrex::Real amr_wind::diagnostics::get_macvel_max(
+amrex::Array<amrex::Real, 2> amr_wind::diagnostics::get_macvel_extrema(
     const amrex::MultiFab& macvel,
     const amrex::iMultiFab& level_mask,
     const int vdir)
 {
-    return get_macvel_max(macvel, level_mask, vdir, 1.0);
-}
-
-amrex::Real amr_wind::diagnostics::get_macvel_min(
-    const amrex::MultiFab& macvel,
-    const amrex::iMultiFab& level_mask,
-    const int vdir)
-{
-    return get_macvel_max(macvel, level_mask, vdir, -1.0);
+    const auto& mvel_arr = macvel.const_arrays();
+    const auto& mask_arr = level_mask.const_arrays();
+    const auto ext = amrex::ParReduce(
+        amrex::TypeList<amrex::ReduceOpMax, amrex::ReduceOpMin>{},
+        amrex::TypeList<amrex::Real, amrex::Real>{}, macvel,
+        amrex::IntVect(0),
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k)
+            -> amrex::GpuTuple<amrex::Real, amrex::Real> {
+            const int ii = i - (vdir == 0 ? 1 : 0);
+            const int jj = j - (vdir == 1 ? 1 : 0);
+            const int kk = k - (vdir == 2 ? 1 : 0);
+            const bool mask_check =
+                (mask_arr[nbx](i, j, k) + mask_arr[nbx](ii, jj, kk) > 0);
+            const amrex::Real val = mvel_arr[nbx](i, j, k);
+            return {
+                mask_check ? val : std::numeric_limits<amrex::Real>::lowest(),
+                mask_check ? val : std::numeric_limits<amrex::Real>::max()};
+        });
+    return {amrex::get<0>(ext), amrex::get<1>(ext)};
 }
 
-amrex::Real amr_wind::diagnostics::get_macvel_loc(
+amrex::Array<amrex::Real, 6> amr_wind::diagnostics::get_macvel_extrema_loc(
     const amrex::MultiFab& macvel,
     const amrex::iMultiFab& level_mask,
     const int vdir,
-    const int ldir,
-    amrex::Real mvel_max,
+    const amrex::Real mvel_max,
+    const amrex::Real mvel_min,
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> problo,
     const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> dx)
 {
-
-    return amrex::ReduceMax(
-        macvel, level_mask, 0,
-        [=] AMREX_GPU_HOST_DEVICE(
-            amrex::Box const& bx,
-            amrex::Array4<amrex::Real const> const& mvel_arr,
-            amrex::Array4<int const> const& mask_arr) -> amrex::Real {
-            amrex::Real loc_fab = problo[ldir];
-            amrex::Loop(bx, [=, &loc_fab](int i, int j, int k) noexcept {
-                int ii = i - (vdir == 0 ? 1 : 0);
-                int jj = j - (vdir == 1 ? 1 : 0);
-                int kk = k - (vdir == 2 ? 1 : 0);
-                int idx = (ldir == 0 ? i : (ldir == 1 ? j : k));
-                amrex::Real offset = (ldir == vdir ? 0.0 : 0.5);
-                amrex::Real loc = problo[ldir] + (idx + offset) * dx[ldir];
-                bool mask_check =
-                    (mask_arr(i, j, k) + mask_arr(ii, jj, kk) > 0);
-                bool loc_check =
-                    (amrex::Math::abs(mvel_max - mvel_arr(i, j, k)) < 1e-10);
-                loc_fab = amrex::max(
-                    loc_fab, (mask_check && loc_check ? loc : problo[ldir]));
-            });
-            return loc_fab;
+    const auto& mvel_arr = macvel.const_arrays();
+    const auto& mask_arr = level_mask.const_arrays();
+    const auto locs = amrex::ParReduce(
+        MaxOps6{}, RealTypes6{}, macvel, amrex::IntVect(0),
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) -> RealTuple6 {
+            const int ii = i - (vdir == 0 ? 1 : 0);
+            const int jj = j - (vdir == 1 ? 1 : 0);
+            const int kk = k - (vdir == 2 ? 1 : 0);
+            const amrex::Real val = mvel_arr[nbx](i, j, k);
+            const bool mask_check =
+                (mask_arr[nbx](i, j, k) + mask_arr[nbx](ii, jj, kk) > 0);
+            const bool max_check =
+                mask_check && (amrex::Math::abs(mvel_max - val) < 1e-10);
+            const bool min_check =
+                mask_check && (amrex::Math::abs(mvel_min - val) < 1e-10);
+            const amrex::Real x =
+                problo[0] + (i + (vdir == 0 ? 0.0 : 0.5)) * dx[0];
+            const amrex::Real y =
+                problo[1] + (j + (vdir == 1 ? 0.0 : 0.5)) * dx[1];
+            const amrex::Real z =
+                problo[2] + (k + (vdir == 2 ? 0.0 : 0.5)) * dx[2];
+            return {
+                max_check ? x : problo[0], max_check ? y : problo[1],
+                max_check ? z : problo[2], min_check ? x : problo[0],
+                min_check ? y : problo[1], min_check ? z : problo[2]};
         });
+    return to_array(locs);
 }
 
 amrex::Array<amrex::Real, 24> amr_wind::diagnostics::PrintMaxVelLocations(
@@ -258,13 +344,10 @@ amrex::Array<amrex::Real, 24> amr_wind::diagnostics::PrintMaxVelLocations(
     const auto& vel = repo.get_field("velocity");
     const int finest_level = repo.num_active_levels() - 1;
 
-    // Get infinity norm of velocities
-    amrex::Real u_max{-1e8}, v_max{-1e8}, w_max{-1e8};
-    // Minima will be negated later
-    amrex::Real u_min{-1e8}, v_min{-1e8}, w_min{-1e8};
+    // Use level_mask to only count finest level present
+    amrex::Vector<amrex::iMultiFab> level_masks(finest_level + 1);
     for (int lev = 0; lev <= finest_level; lev++) {
-        // Use level_mask to only count finest level present
-        amrex::iMultiFab level_mask;
+        auto& level_mask = level_masks[lev];
         if (lev < finest_level) {
             level_mask = makeFineMask(
                 repo.mesh().boxArray(lev), repo.mesh().DistributionMap(lev),
@@ -275,159 +358,41 @@ amrex::Array<amrex::Real, 24> amr_wind::diagnostics::PrintMaxVelLocations(
                 0, amrex::MFInfo());
             level_mask.setVal(1);
         }
-
-        u_max = amrex::max(
-            u_max, amr_wind::diagnostics::get_vel_max(vel(lev), level_mask, 0));
-
-        u_min = amrex::max(
-            u_min, amr_wind::diagnostics::get_vel_min(vel(lev), level_mask, 0));
-
-        v_max = amrex::max(
-            v_max, amr_wind::diagnostics::get_vel_max(vel(lev), level_mask, 1));
-
-        v_min = amrex::max(
-            v_min, amr_wind::diagnostics::get_vel_min(vel(lev), level_mask, 1));
-
-        w_max = amrex::max(
-            w_max, amr_wind::diagnostics::get_vel_max(vel(lev), level_mask, 2));
-
-        w_min = amrex::max(
-            w_min, amr_wind::diagnostics::get_vel_min(vel(lev), level_mask, 2));
     }
 
-    // Do additional parallelism stuff
-    amrex::ParallelDescriptor::ReduceRealMax(u_max);
-    amrex::ParallelDescriptor::ReduceRealMax(v_max);
-    amrex::ParallelDescriptor::ReduceRealMax(w_max);
-    amrex::ParallelDescriptor::ReduceRealMax(u_min);
-    amrex::ParallelDescriptor::ReduceRealMax(v_min);
-    amrex::ParallelDescriptor::ReduceRealMax(w_min);
-
-    // Negate minima
-    u_min *= -1.0;
-    v_min *= -1.0;
-    w_min *= -1.0;
-
-    // Get locations of these extrema
-    auto problo = (repo.mesh().Geom())[0].ProbLoArray();
-    amrex::GpuArray<amrex::Real, 3> u_max_loc{problo[0], problo[1], problo[2]};
-    amrex::GpuArray<amrex::Real, 3> v_max_loc{problo[0], problo[1], problo[2]};
-    amrex::GpuArray<amrex::Real, 3> w_max_loc{problo[0], problo[1], problo[2]};
-    amrex::GpuArray<amrex::Real, 3> u_min_loc{problo[0], problo[1], problo[2]};
-    amrex::GpuArray<amrex::Real, 3> v_min_loc{problo[0], problo[1], problo[2]};
-    amrex::GpuArray<amrex::Real, 3> w_min_loc{problo[0], problo[1], problo[2]};
+    // Get infinity norm of velocities, all components in a single sweep
+    ReductionBatch extrema;
+    for (int n = 0; n < 3; ++n) {
+        extrema.max(extremum_name(n, true), -1e8);
+        extrema.min(extremum_name(n, false), 1e8);
+    }
     for (int lev = 0; lev <= finest_level; lev++) {
-        // Use level_mask to only count finest level present
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            level_mask = makeFineMask(
-                repo.mesh().boxArray(lev), repo.mesh().DistributionMap(lev),
-                repo.mesh().boxArray(lev + 1), repo.mesh().refRatio(lev), 1, 0);
-        } else {
-            level_mask.define(
-                repo.mesh().boxArray(lev), repo.mesh().DistributionMap(lev), 1,
-                0, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
-        problo = (repo.mesh().Geom())[lev].ProbLoArray();
-        auto dx = (repo.mesh().Geom())[lev].CellSizeArray();
-
-        // Loop coordinates directions
-        for (int n = 0; n < 3; n++) {
-            u_max_loc[n] = amrex::max(
-                u_max_loc[n],
-                amr_wind::diagnostics::get_vel_loc(
-                    vel(lev), level_mask, 0, n, u_max, problo, dx));
-
-            u_min_loc[n] = amrex::max(
-                u_min_loc[n],
-                amr_wind::diagnostics::get_vel_loc(
-                    vel(lev), level_mask, 0, n, u_min, problo, dx));
-
-            v_max_loc[n] = amrex::max(
-                v_max_loc[n],
-                amr_wind::diagnostics::get_vel_loc(
-                    vel(lev), level_mask, 1, n, v_max, problo, dx));
-
-            v_min_loc[n] = amrex::max(
-                v_min_loc[n],
-                amr_wind::diagnostics::get_vel_loc(
-                    vel(lev), level_mask, 1, n, v_min, problo, dx));
-
-            w_max_loc[n] = amrex::max(
-                w_max_loc[n],
-                amr_wind::diagnostics::get_vel_loc(
-                    vel(lev), level_mask, 2, n, w_max, problo, dx));
-
-            w_min_loc[n] = amrex::max(
-                w_min_loc[n],
-                amr_wind::diagnostics::get_vel_loc(
-                    vel(lev), level_mask, 2, n, w_min, problo, dx));
+        const auto ext = get_vel_extrema(vel(lev), level_masks[lev]);
+        for (int n = 0; n < 3; ++n) {
+            extrema.max(extremum_name(n, true), ext[2 * n]);
+            extrema.min(extremum_name(n, false), ext[2 * n + 1]);
         }
     }
+    extrema.reduce();
 
-    // Additional parallelism
-    for (int n = 0; n < 3; ++n) {
-        amrex::ParallelDescriptor::ReduceRealMax(u_max_loc[n]);
-        amrex::ParallelDescriptor::ReduceRealMax(v_max_loc[n]);
-        amrex::ParallelDescriptor::ReduceRealMax(w_max_loc[n]);
-        amrex::ParallelDescriptor::ReduceRealMax(u_min_loc[n]);
-        amrex::ParallelDescriptor::ReduceRealMax(v_min_loc[n]);
-        amrex::ParallelDescriptor::ReduceRealMax(w_min_loc[n]);
+    // Get locations of these extrema
+    ReductionBatch locations;
+    add_default_locations(locations, (repo.mesh().Geom())[0].ProbLoArray());
+    for (int lev = 0; lev <= finest_level; lev++) {
+        const auto problo = (repo.mesh().Geom())[lev].ProbLoArray();
+        const auto dx = (repo.mesh().Geom())[lev].CellSizeArray();
+        for (int n = 0; n < 3; ++n) {
+            add_locations(
+                locations, n,
+                get_vel_extrema_loc(
+                    vel(lev), level_masks[lev], n,
+                    extrema.value(extremum_name(n, true)),
+                    extrema.value(extremum_name(n, false)), problo, dx));
+        }
     }
+    locations.reduce();
 
-    // Output results
-    amrex::Print() << "\nL-inf norm vels: " << header << std::endl
-                   << "........................................................"
-                      "......................"
-                   << std::endl;
-
-    amrex::Print() << "Max u: " << std::setw(20) << std::right << u_max;
-    amrex::Print() << " |  Location (x,y,z): ";
-    amrex::Print() << std::setw(10) << std::right << u_max_loc[0] << ", ";
-    amrex::Print() << std::setw(10) << std::right << u_max_loc[1] << ", ";
-    amrex::Print() << std::setw(10) << std::right << u_max_loc[2] << std::endl;
-    amrex::Print() << "Min u: " << std::setw(20) << std::right << u_min;
-    amrex::Print() << " |  Location (x,y,z): ";
-    amrex::Print() << std::setw(10) << std::right << u_min_loc[0] << ", ";
-    amrex::Print() << std::setw(10) << std::right << u_min_loc[1] << ", ";
-    amrex::Print() << std::setw(10) << std::right << u_min_loc[2] << std::endl;
-
-    amrex::Print() << "Max v: " << std::setw(20) << std::right << v_max;
-    amrex::Print() << " |  Location (x,y,z): ";
-    amrex::Print() << std::setw(10) << std::right << v_max_loc[0] << ", ";
-    amrex::Print() << std::setw(10) << std::right << v_max_loc[1] << ", ";
-    amrex::Print() << std::setw(10) << std::right << v_max_loc[2] << std::endl;
-    amrex::Print() << "Min v: " << std::setw(20) << std::right << v_min;
-    amrex::Print() << " |  Location (x,y,z): ";
-    amrex::Print() << std::setw(10) << std::right << v_min_loc[0] << ", ";
-    amrex::Print() << std::setw(10) << std::right << v_min_loc[1] << ", ";
-    amrex::Print() << std::setw(10) << std::right << v_min_loc[2] << std::endl;
-
-    amrex::Print() << "Max w: " << std::setw(20) << std::right << w_max;
-    amrex::Print() << " |  Location (x,y,z): ";
-    amrex::Print() << std::setw(10) << std::right << w_max_loc[0] << ", ";
-    amrex::Print() << std::setw(10) << std::right << w_max_loc[1] << ", ";
-    amrex::Print() << std::setw(10) << std::right << w_max_loc[2] << std::endl;
-    amrex::Print() << "Min w: " << std::setw(20) << std::right << w_min;
-    amrex::Print() << " |  Location (x,y,z): ";
-    amrex::Print() << std::setw(10) << std::right << w_min_loc[0] << ", ";
-    amrex::Print() << std::setw(10) << std::right << w_min_loc[1] << ", ";
-    amrex::Print() << std::setw(10) << std::right << w_min_loc[2] << std::endl;
-
-    amrex::Print() << "........................................................"
-                      "......................"
-                   << std::endl
-                   << std::endl;
-
-    // Return array of answers (for testing)
-    return amrex::Array<amrex::Real, 24>{
-        u_max,        u_max_loc[0], u_max_loc[1], u_max_loc[2], u_min,
-        u_min_loc[0], u_min_loc[1], u_min_loc[2], v_max,        v_max_loc[0],
-        v_max_loc[1], v_max_loc[2], v_min,        v_min_loc[0], v_min_loc[1],
-        v_min_loc[2], w_max,        w_max_loc[0], w_max_loc[1], w_max_loc[2],
-        w_min,        w_min_loc[0], w_min_loc[1], w_min_loc[2]};
+    return print_extrema("L-inf norm vels: ", header, extrema, locations);
 }
 
 amrex::Array<amrex::Real, 24> amr_wind::diagnostics::PrintMaxMACVelLocations(
@@ -436,19 +401,16 @@ amrex::Array<amrex::Real, 24> amr_wind::diagnostics::PrintMaxMACVelLocations(
     BL_PROFILE("amr-wind::diagnostics::PrintMaxMACVelLocations");
 
     // Get fields
-    const auto& u_mac = repo.get_field("u_mac");
-    const auto& v_mac = repo.get_field("v_mac");
-    const auto& w_mac = repo.get_field("w_mac");
+    const amrex::Array<const Field*, 3> mac_vels{
+        &repo.get_field("u_mac"), &repo.get_field("v_mac"),
+        &repo.get_field("w_mac")};
     const int finest_level = repo.num_active_levels() - 1;
 
-    // Get infinity norm of mac velocities
-    amrex::Real uMAC_max{-1e8}, vMAC_max{-1e8}, wMAC_max{-1e8};
-    // Minima will be negated later
-    amrex::Real uMAC_min{-1e8}, vMAC_min{-1e8}, wMAC_min{-1e8};
+    // Use level_mask to only count finest level present
+    // Do it with a ghost cell for the sake of checking faces
+    amrex::Vector<amrex::iMultiFab> level_masks(finest_level + 1);
     for (int lev = 0; lev <= finest_level; lev++) {
-        // Use level_mask to only count finest level present
-        // Do it with a ghost cell for the sake of checking faces
-        amrex::iMultiFab level_mask;
+        auto& level_mask = level_masks[lev];
         if (lev < finest_level) {
             // MultiFab with ghost cell
             level_mask.define(
@@ -470,190 +432,42 @@ amrex::Array<amrex::Real, 24> amr_wind::diagnostics::PrintMaxMACVelLocations(
                 1, amrex::MFInfo());
             level_mask.setVal(1);
         }
-
-        uMAC_max = amrex::max(
-            uMAC_max,
-            amr_wind::diagnostics::get_macvel_max(u_mac(lev), level_mask, 0));
-
-        uMAC_min = amrex::max(
-            uMAC_min,
-            amr_wind::diagnostics::get_macvel_min(u_mac(lev), level_mask, 0));
-
-        vMAC_max = amrex::max(
-            vMAC_max,
-            amr_wind::diagnostics::get_macvel_max(v_mac(lev), level_mask, 1));
-
-        vMAC_min = amrex::max(
-            vMAC_min,
-            amr_wind::diagnostics::get_macvel_min(v_mac(lev), level_mask, 1));
-
-        wMAC_max = amrex::max(
-            wMAC_max,
-            amr_wind::diagnostics::get_macvel_max(w_mac(lev), level_mask, 2));
-
-        wMAC_min = amrex::max(
-            wMAC_min,
-            amr_wind::diagnostics::get_macvel_min(w_mac(lev), level_mask, 2));
     }
 
-    // Do additional parallelism stuff
-    amrex::ParallelDescriptor::ReduceRealMax(uMAC_max);
-    amrex::ParallelDescriptor::ReduceRealMax(vMAC_max);
-    amrex::ParallelDescriptor::ReduceRealMax(wMAC_max);
-    amrex::ParallelDescriptor::ReduceRealMax(uMAC_min);
-    amrex::ParallelDescriptor::ReduceRealMax(vMAC_min);
-    amrex::ParallelDescriptor::ReduceRealMax(wMAC_min);
-
-    // Negate minima
-    uMAC_min *= -1.0;
-    vMAC_min *= -1.0;
-    wMAC_min *= -1.0;
-
-    // Get locations of these extrema
-    auto problo = (repo.mesh().Geom())[0].ProbLoArray();
-    amrex::GpuArray<amrex::Real, 3> uMAC_max_loc{
-        problo[0], problo[1], problo[2]};
-    amrex::GpuArray<amrex::Real, 3> vMAC_max_loc{
-        problo[0], problo[1], problo[2]};
-    amrex::GpuArray<amrex::Real, 3> wMAC_max_loc{
-        problo[0], problo[1], problo[2]};
-    amrex::GpuArray<amrex::Real, 3> uMAC_min_loc{
-        problo[0], problo[1], problo[2]};
-    amrex::GpuArray<amrex::Real, 3> vMAC_min_loc{
-        problo[0], problo[1], problo[2]};
-    amrex::GpuArray<amrex::Real, 3> wMAC_min_loc{
-        problo[0], problo[1], problo[2]};
+    // Get infinity norm of mac velocities
+    ReductionBatch extrema;
+    for (int n = 0; n < 3; ++n) {
+        extrema.max(extremum_name(n, true), -1e8);
+        extrema.min(extremum_name(n, false), 1e8);
+    }
     for (int lev = 0; lev <= finest_level; lev++) {
-        // Use level_mask to only count finest level present
-        // Do it with a ghost cell for the sake of checking faces
-        amrex::iMultiFab level_mask;
-        if (lev < finest_level) {
-            // MultiFab with ghost cell
-            level_mask.define(
-                repo.mesh().boxArray(lev), repo.mesh().DistributionMap(lev), 1,
-                1, amrex::MFInfo());
-            // Set to 0 (ghost cells will be 0)
-            level_mask.setVal(0);
-            // Populate non-ghost cells with fine mask
-            amrex::iMultiFab::Copy(
-                level_mask,
-                makeFineMask(
-                    repo.mesh().boxArray(lev), repo.mesh().DistributionMap(lev),
-                    repo.mesh().boxArray(lev + 1), repo.mesh().refRatio(lev), 1,
-                    0),
-                0, 0, 1, amrex::IntVect(0));
-        } else {
-            level_mask.define(
-                repo.mesh().boxArray(lev), repo.mesh().DistributionMap(lev), 1,
-                1, amrex::MFInfo());
-            level_mask.setVal(1);
-        }
-
-        problo = (repo.mesh().Geom())[lev].ProbLoArray();
-        auto dx = (repo.mesh().Geom())[lev].CellSizeArray();
-
-        // Loop coordinates directions
-        for (int n = 0; n < 3; n++) {
-            uMAC_max_loc[n] = amrex::max(
-                uMAC_max_loc[n],
-                amr_wind::diagnostics::get_macvel_loc(
-                    u_mac(lev), level_mask, 0, n, uMAC_max, problo, dx));
-
-            uMAC_min_loc[n] = amrex::max(
-                uMAC_min_loc[n],
-                amr_wind::diagnostics::get_macvel_loc(
-                    u_mac(lev), level_mask, 0, n, uMAC_min, problo, dx));
-
-            vMAC_max_loc[n] = amrex::max(
-                vMAC_max_loc[n],
-                amr_wind::diagnostics::get_macvel_loc(
-                    v_mac(lev), level_mask, 1, n, vMAC_max, problo, dx));
-
-            vMAC_min_loc[n] = amrex::max(
-                vMAC_min_loc[n],
-                amr_wind::diagnostics::get_macvel_loc(
-                    v_mac(lev), level_mask, 1, n, vMAC_min, problo, dx));
-
-            wMAC_max_loc[n] = amrex::max(
-                wMAC_max_loc[n],
-                amr_wind::diagnostics::get_macvel_loc(
-                    w_mac(lev), level_mask, 2, n, wMAC_max, problo, dx));
-
-            wMAC_min_loc[n] = amrex::max(
-                wMAC_min_loc[n],
-                amr_wind::diagnostics::get_macvel_loc(
-                    w_mac(lev), level_mask, 2, n, wMAC_min, problo, dx));
+        for (int n = 0; n < 3; ++n) {
+            const auto ext =
+                get_macvel_extrema((*mac_vels[n])(lev), level_masks[lev], n);
+            extrema.max(extremum_name(n, true), ext[0]);
+            extrema.min(extremum_name(n, false), ext[1]);
         }
     }
+    extrema.reduce();
 
-    // Additional parallelism
-    for (int n = 0; n < 3; ++n) {
-        amrex::ParallelDescriptor::ReduceRealMax(uMAC_max_loc[n]);
-        amrex::ParallelDescriptor::ReduceRealMax(vMAC_max_loc[n]);
-        amrex::ParallelDescriptor::ReduceRealMax(wMAC_max_loc[n]);
-        amrex::ParallelDescriptor::ReduceRealMax(uMAC_min_loc[n]);
-        amrex::ParallelDescriptor::ReduceRealMax(vMAC_min_loc[n]);
-        amrex::ParallelDescriptor::ReduceRealMax(wMAC_min_loc[n]);
+    // Get locations of these extrema
+    ReductionBatch locations;
+    add_default_locations(locations, (repo.mesh().Geom())[0].ProbLoArray());
+    for (int lev = 0; lev <= finest_level; lev++) {
+        const auto problo = (repo.mesh().Geom())[lev].ProbLoArray();
+        const auto dx = (repo.mesh().Geom())[lev].CellSizeArray();
+        for (int n = 0; n < 3; ++n) {
+            add_locations(
+                locations, n,
+                get_macvel_extrema_loc(
+                    (*mac_vels[n])(lev), level_masks[lev], n,
+                    extrema.value(extremum_name(n, true)),
+                    extrema.value(extremum_name(n, false)), problo, dx));
+        }
     }
+    locations.reduce();
 
-    // Output results
-    amrex::Print() << "\nL-inf norm MAC vels: " << header << std::endl
-                   << "........................................................"
-                      "......................"
-                   << std::endl;
-
-    amrex::Print() << "Max u: " << std::setw(20) << std::right << uMAC_max;
-    amrex::Print() << " |  Location (x,y,z): ";
-    amrex::Print() << std::setw(10) << std::right << uMAC_max_loc[0] << ", ";
-    amrex::Print() << std::setw(10) << std::right << uMAC_max_loc[1] << ", ";
-    amrex::Print() << std::setw(10) << std::right << uMAC_max_loc[2]
-                   << std::endl;
-    amrex::Print() << "Min u: " << std::setw(20) << std::right << uMAC_min;
-    amrex::Print() << " |  Location (x,y,z): ";
-    amrex::Print() << std::setw(10) << std::right << uMAC_min_loc[0] << ", ";
-    amrex::Print() << std::setw(10) << std::right << uMAC_min_loc[1] << ", ";
-    amrex::Print() << std::setw(10) << std::right << uMAC_min_loc[2]
-                   << std::endl;
-
-    amrex::Print() << "Max v: " << std::setw(20) << std::right << vMAC_max;
-    amrex::Print() << " |  Location (x,y,z): ";
-    amrex::Print() << std::setw(10) << std::right << vMAC_max_loc[0] << ", ";
-    amrex::Print() << std::setw(10) << std::right << vMAC_max_loc[1] << ", ";
-    amrex::Print() << std::setw(10) << std::right << vMAC_max_loc[2]
-                   << std::endl;
-    amrex::Print() << "Min v: " << std::setw(20) << std::right << vMAC_min;
-    amrex::Print() << " |  Location (x,y,z): ";
-    amrex::Print() << std::setw(10) << std::right << vMAC_min_loc[0] << ", ";
-    amrex::Print() << std::setw(10) << std::right << vMAC_min_loc[1] << ", ";
-    amrex::Print() << std::setw(10) << std::right << vMAC_min_loc[2]
-                   << std::endl;
-
-    amrex::Print() << "Max w: " << std::setw(20) << std::right << wMAC_max;
-    amrex::Print() << " |  Location (x,y,z): ";
-    amrex::Print() << std::setw(10) << std::right << wMAC_max_loc[0] << ", ";
-    amrex::Print() << std::setw(10) << std::right << wMAC_max_loc[1] << ", ";
-    amrex::Print() << std::setw(10) << std::right << wMAC_max_loc[2]
-                   << std::endl;
-    amrex::Print() << "Min w: " << std::setw(20) << std::right << wMAC_min;
-    amrex::Print() << " |  Location (x,y,z): ";
-    amrex::Print() << std::setw(10) << std::right << wMAC_min_loc[0] << ", ";
-    amrex::Print() << std::setw(10) << std::right << wMAC_min_loc[1] << ", ";
-    amrex::Print() << std::setw(10) << std::right << wMAC_min_loc[2]
-                   << std::endl;
-
-    amrex::Print() << "........................................................"
-                      "......................"
-                   << std::endl
-                   << std::endl;
-
-    // Return array of answers (for testing)
-    return amrex::Array<amrex::Real, 24>{
-        uMAC_max, uMAC_max_loc[0], uMAC_max_loc[1], uMAC_max_loc[2],
-        uMAC_min, uMAC_min_loc[0], uMAC_min_loc[1], uMAC_min_loc[2],
-        vMAC_max, vMAC_max_loc[0], vMAC_max_loc[1], vMAC_max_loc[2],
-        vMAC_min, vMAC_min_loc[0], vMAC_min_loc[1], vMAC_min_loc[2],
-        wMAC_max, wMAC_max_loc[0], wMAC_max_loc[1], wMAC_max_loc[2],
-        wMAC_min, wMAC_min_loc[0], wMAC_min_loc[1], wMAC_min_loc[2]};
+    return print_extrema("L-inf norm MAC vels: ", header, extrema, locations);
 }
 
 //
@@ -282,6 +282,19 @@ void NCVar::par_access(const int cmode) const
     check_nc_error(nc_var_par_access(ncid, varid, cmode));
 }
 
+void NCVar::set_chunking(const std::vector<size_t>& chunks) const
+{
+    AMREX_ALWAYS_ASSERT(static_cast<int>(chunks.size()) == ndim());
+    check_nc_error(nc_def_var_chunking(ncid, varid, NC_CHUNKED, chunks.data()));
+}
+
+void NCVar::set_deflate(const int level, const bool shuffle) const
+{
+    check_nc_error(nc_def_var_deflate(
+        ncid, varid, static_cast<int>(shuffle), static_cast<int>(level > 0),
+        level));
+}
+
 std::string NCGroup::name() const
 {
     size_t nlen;
@@ -568,6 +581,12 @@ NCFile NCFile::open_par(
     return NCFile(ncid);
 }
 
+NCFile::NCFile(NCFile&& other) noexcept
+    : NCGroup(other.ncid), m_is_open(other.m_is_open)
+{
+    other.m_is_open = false;
+}
+
 NCFile::~NCFile()
 {
     if (m_is_open) {
@@ -5,10 +5,181 @@
 #include "amr-wind/equation_systems/vof/volume_fractions.H"
 #include "amr-wind/utilities/index_operations.H"
 
+#include "AMReX_OpenMP.H"
 #include "AMReX_ParmParse.H"
 
 namespace amr_wind::sampling {
 
+namespace {
+
+/** Height of the interface within a cell at a sample location
+ *
+ *  Returns false when no interface is found in the cell; otherwise the
+ *  height lies within the bounds of the cell
+ */
+AMREX_GPU_DEVICE AMREX_FORCE_INLINE bool cell_interface_height(
+    const int i,
+    const int j,
+    const int k,
+    const int ni,
+    const int dir,
+    const int gc0,
+    const int gc1,
+    const amrex::Real loc0,
+    const amrex::Real loc1,
+    const bool use_linear_interp,
+    amrex::Array4<amrex::Real const> const& vof_arr,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& xm,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dx,
+    const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>& dxi,
+    const amrex::Real plo_dir,
+    amrex::Real& ht)
+{
+    // Indices and slope variables
+    // Get modified indices for checking up
+    // and down and orient normal in search
+    // direction
+    amrex::Real mx = (dir == 0) ? 1.0 : 0.0;
+    amrex::Real my = (dir == 1) ? 1.0 : 0.0;
+    amrex::Real mz = (dir == 2) ? 1.0 : 0.0;
+    amrex::Real alpha = 1.0;
+    // If cell is full of single phase
+    // (accounts for when interface is at
+    // intersection of cells but lower one
+    // is not single-phase)
+    bool calc_flag = false;
+    bool calc_flag_diffuse = false;
+    const bool single_phase_below_interface =
+        (ni % 2 == 0 && vof_arr(i, j, k) >= 1.0 - 1e-12) ||
+        (ni % 2 != 0 && vof_arr(i, j, k) <= 1e-12);
+    const bool multiphase =
+        vof_arr(i, j, k) < (1.0 - 1e-12) && vof_arr(i, j, k) > 1e-12;
+    const bool single_phase_above_interface =
+        !(multiphase || single_phase_below_interface);
+    if (single_phase_below_interface) {
+        // put bdy at top
+        alpha = 1.0;
+        if (ni % 2 != 0) {
+            mx *= -1.0;
+            my *= -1.0;
+            mz *= -1.0;
+            alpha *= -1.0;
+        }
+        calc_flag = true;
+    }
+    // Multiphase cell case
+    if (multiphase) {
+        if (!use_linear_interp) {
+            // Planar reconstruction
+            calc_flag = true;
+            multiphase::fit_plane(i, j, k, vof_arr, mx, my, mz, alpha);
+        } else {
+            // Interpolation (later)
+            calc_flag_diffuse = true;
+        }
+    }
+    // Single-phase cell bordering other phase, does
+    // not fit into other categories
+    if (single_phase_above_interface && use_linear_interp) {
+        // With linear interp, interface can show up
+        // in single-phase cell
+        const amrex::IntVect iv{i, j, k};
+        amrex::IntVect iv_p = iv;
+        amrex::IntVect iv_m = iv;
+        iv_p[dir] += 1;
+        iv_m[dir] -= 1;
+        // Check for 0.5 intersect
+        const bool intersect_above =
+            (vof_arr(iv_p) - 0.5) * (vof_arr(iv) - 0.5) <= 0;
+        const bool intersect_below =
+            (vof_arr(iv) - 0.5) * (vof_arr(iv_m) - 0.5) <= 0;
+        calc_flag_diffuse = calc_flag_diffuse || intersect_above;
+        calc_flag_diffuse = calc_flag_diffuse || intersect_below;
+    }
+
+    // Initialize height measurement
+    ht = plo_dir;
+    if (calc_flag) {
+        // Reassign slope coefficients
+        const amrex::Real mdr = (dir == 0) ? mx : ((dir == 1) ? my : mz);
+        const amrex::Real mg1 = (dir == 0) ? my : mx;
+        const amrex::Real mg2 = (dir == 2) ? my : mz;
+        // Get height of interface
+        if (mdr == 0) {
+            // If slope is undefined in z,
+            // use middle of cell
+            ht = xm[dir];
+        } else {
+            // Intersect 2D point with plane
+            ht = (xm[dir] - 0.5 * dx[dir]) +
+                 (alpha - mg1 * dxi[gc0] * (loc0 - (xm[gc0] - 0.5 * dx[gc0])) -
+                  mg2 * dxi[gc1] * (loc1 - (xm[gc1] - 0.5 * dx[gc1]))) /
+                     (mdr * dxi[dir]);
+        }
+    }
+    if (calc_flag_diffuse) {
+        const amrex::Real dv_xl = vof_arr(i, j, k) - vof_arr(i - 1, j, k);
+        const amrex::Real dv_xr = vof_arr(i + 1, j, k) - vof_arr(i, j, k);
+        const amrex::Real dv_yl = vof_arr(i, j, k) - vof_arr(i, j - 1, k);
+        const amrex::Real dv_yr = vof_arr(i, j + 1, k) - vof_arr(i, j, k);
+        const amrex::Real dv_zl = vof_arr(i, j, k) - vof_arr(i, j, k - 1);
+        const amrex::Real dv_zr = vof_arr(i, j, k + 1) - vof_arr(i, j, k);
+        // Distances from cell center to probe loc
+        const amrex::Real dist_0 = loc0 - xm[gc0];
+        const amrex::Real dist_1 = loc1 - xm[gc1];
+        // Slopes on either side
+        amrex::Real slope_dir_r = dir == 0 ? dv_xr : (dir == 1 ? dv_yr : dv_zr);
+        amrex::Real slope_dir_l = dir == 0 ? dv_xl : (dir == 1 ? dv_yl : dv_zl);
+        // One-sided slopes for when sign of
+        // distance to interface is known
+        amrex::Real slope_0 = dist_0 > 0 ? (dir == 0 ? dv_yr : dv_xr)
+                                         : (dir == 0 ? dv_yl : dv_xl);
+        amrex::Real slope_1 = dist_1 > 0 ? (dir == 2 ? dv_yr : dv_zr)
+                                         : (dir == 2 ? dv_yl : dv_zl);
+        // Turn finite differences into true slopes
+        slope_dir_r *= dxi[dir];
+        slope_dir_l *= dxi[dir];
+        slope_0 *= dxi[gc0];
+        slope_1 *= dxi[gc1];
+        // Trilinear interpolation for vof
+        const amrex::Real vof_c =
+            vof_arr(i, j, k) + slope_0 * dist_0 + slope_1 * dist_1;
+        // Extrapolate to cell edge (0.5) plus a
+        // factor of safety (0.1) because
+        // reconstruction is not identical in
+        // neighboring cells
+        const amrex::Real vof_r = vof_c + 0.6 * slope_dir_r * dx[dir];
+        const amrex::Real vof_l = vof_c - 0.6 * slope_dir_l * dx[dir];
+        // Check for intersect with 0.5
+        if ((vof_c - 0.5) * (vof_r - 0.5) <= 0.) {
+            ht = xm[dir] + (0.5 - vof_c) / (slope_dir_r + constants::EPS);
+        } else if ((vof_c - 0.5) * (vof_l - 0.5) <= 0.) {
+            ht = xm[dir] + (0.5 - vof_c) / (slope_dir_l + constants::EPS);
+        } else {
+            // Skip if no intersection
+            ht = plo_dir;
+        }
+    }
+
+    if (!(calc_flag || calc_flag_diffuse)) {
+        return false;
+    }
+    // If interface is below lower
+    // bound, continue to look
+    if (ht < xm[dir] - 0.5 * dx[dir]) {
+        ht = plo_dir;
+        return false;
+    }
+    // If interface is above upper
+    // bound, limit it
+    if (ht > xm[dir] + 0.5 * dx[dir] * (1.0 + 1e-8)) {
+        ht = xm[dir] + 0.5 * dx[dir];
+    }
+    return true;
+}
+
+} // namespace
+
 FreeSurfaceSampler::FreeSurfaceSampler(CFDSim& sim)
     : m_sim(sim), m_vof(sim.repo().get_field("vof"))
 {}
@@ -241,13 +412,14 @@ void FreeSurfaceSampler::initialize(const std::string& key)
         const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> phi =
             geom.ProbHiArray();
 #ifdef AMREX_USE_OMP
-#pragma omp parallel if (false)
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
-        for (amrex::MFIter mfi(floc(lev)); mfi.isValid(); ++mfi) {
+        for (amrex::MFIter mfi(floc(lev), amrex::TilingIfNotGPU());
+             mfi.isValid(); ++mfi) {
             auto loc_arr = floc(lev).array(mfi);
             auto idx_arr = fidx(lev).array(mfi);
             auto mask_arr = level_mask.const_array(mfi);
-            const auto& vbx = mfi.validbox();
+            const auto& vbx = mfi.tilebox();
             amrex::ParallelFor(
                 vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
                     // Cell location
@@ -428,6 +600,12 @@ bool FreeSurfaceSampler::update_sampling_locations()
         m_npts, phi0[m_coorddir] + 1.0);
     auto* dlst_ptr = dout_last.data();
 
+    // The atomic max is not thread safe on the host, so every thread
+    // accumulates the heights in its own buffer, merged after the search
+    const int nthreads =
+        amrex::Gpu::notInLaunchRegion() ? amrex::OpenMP::get_max_threads() : 1;
+    amrex::Vector<amrex::Real> thread_out;
+
     // Get working fields
     auto& fidx = m_sim.repo().get_int_field("sample_idx_" + m_label);
     auto& floc = m_sim.repo().get_field("sample_loc_" + m_label);
@@ -439,6 +617,7 @@ bool FreeSurfaceSampler::update_sampling_locations()
     const int gc0 = m_gc0;
     const int gc1 = m_gc1;
     const int ncomp = m_ncomp;
+    const int npts = m_npts;
 
     bool use_linear = m_use_linear;
     const amrex::Real lx_linear = m_lx_linear;
@@ -450,6 +629,10 @@ bool FreeSurfaceSampler::update_sampling_locations()
 
     // Loop instances
     for (int ni = 0; ni < m_ninst; ++ni) {
+        if (nthreads > 1) {
+            thread_out.assign(
+                static_cast<long>(nthreads) * m_npts, plo0[m_coorddir]);
+        }
         for (int lev = 0; lev <= finest_level; lev++) {
             // Level mask info is built into idx info
 
@@ -463,220 +646,81 @@ bool FreeSurfaceSampler::update_sampling_locations()
                 geom.ProbLoArray();
             const amrex::Real xhi = geom.ProbHi(0);
 #ifdef AMREX_USE_OMP
-#pragma omp parallel if (false)
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
-            for (amrex::MFIter mfi(floc(lev)); mfi.isValid(); ++mfi) {
+            for (amrex::MFIter mfi(floc(lev), amrex::TilingIfNotGPU());
+                 mfi.isValid(); ++mfi) {
                 auto loc_arr = floc(lev).const_array(mfi);
                 auto idx_arr = fidx(lev).const_array(mfi);
                 auto vof_arr = m_vof(lev).const_array(mfi);
                 auto ibl_arr = has_overset ? (*iblank_ptr)(lev).const_array(mfi)
                                            : amrex::Array4<int>();
-                const auto& vbx = mfi.validbox();
+                amrex::Real* out_ptr = dout_ptr;
+                if (nthreads > 1) {
+                    out_ptr = thread_out.data() +
+                              static_cast<long>(
+                                  amrex::OpenMP::get_thread_num()) *
+                                  npts;
+                }
+                // Search every column of cells along the search direction
+                const auto& bx = mfi.tilebox();
+                const int mlo = bx.smallEnd(dir);
+                const int mhi = bx.bigEnd(dir);
+                amrex::Box cbx = bx;
+                cbx.setBig(dir, mlo);
                 amrex::ParallelFor(
-                    vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-                        // Cell location
-                        amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> xm;
-                        xm[0] = plo[0] + (i + 0.5) * dx[0];
-                        xm[1] = plo[1] + (j + 0.5) * dx[1];
-                        xm[2] = plo[2] + (k + 0.5) * dx[2];
-                        bool linear_on =
-                            use_linear && (xm[0] >= xhi - lx_linear);
+                    cbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
                         // Loop number of components
                         for (int n = 0; n < ncomp; ++n) {
-                            // Get index of current component and cell
-                            const int idx = idx_arr(i, j, k, n);
-                            // Proceed if there is sample point at this i,j,k,n
-                            // and that cell height is below previous instance
-                            if (idx >= 0 && dlst_ptr[amrex::max(0, idx)] >
-                                                xm[dir] + 0.5 * dx[dir]) {
-                                // Get sample locations from field loc
-                                amrex::Real loc0 = loc_arr(i, j, k, 2 * n);
-                                amrex::Real loc1 = loc_arr(i, j, k, 2 * n + 1);
-
-                                // Indices and slope variables
-                                // Get modified indices for checking up
-                                // and down and orient normal in search
-                                // direction
-                                amrex::Real mx = (dir == 0) ? 1.0 : 0.0;
-                                amrex::Real my = (dir == 1) ? 1.0 : 0.0;
-                                amrex::Real mz = (dir == 2) ? 1.0 : 0.0;
-                                amrex::Real alpha = 1.0;
-                                // If cell is full of single phase
-                                // (accounts for when interface is at
-                                // intersection of cells but lower one
-                                // is not single-phase)
-                                bool calc_flag = false;
-                                bool calc_flag_diffuse = false;
-                                const bool single_phase_below_interface =
-                                    (ni % 2 == 0 &&
-                                     vof_arr(i, j, k) >= 1.0 - 1e-12) ||
-                                    (ni % 2 != 0 && vof_arr(i, j, k) <= 1e-12);
-                                const bool multiphase =
-                                    vof_arr(i, j, k) < (1.0 - 1e-12) &&
-                                    vof_arr(i, j, k) > 1e-12;
+                            amrex::Real ht_max = plo[dir];
+                            int idx_max = -1;
+                            // Heights found in a cell lie within its bounds,
+                            // so search from the top and stop below the
+                            // first cell with an interface (the next cell
+                            // is included to account for the tolerance on
+                            // the upper bound)
+                            int m_stop = mlo;
+                            for (int m = mhi; m >= m_stop; --m) {
+                                amrex::IntVect iv{i, j, k};
+                                iv[dir] = m;
+                                // Get index of current component and cell
+                                const int idx = idx_arr(iv, n);
+                                // Cell location
+                                amrex::GpuArray<amrex::Real, AMREX_SPACEDIM>
+                                    xm;
+                                xm[0] = plo[0] + (iv[0] + 0.5) * dx[0];
+                                xm[1] = plo[1] + (iv[1] + 0.5) * dx[1];
+                                xm[2] = plo[2] + (iv[2] + 0.5) * dx[2];
+                                // Proceed if there is sample point at this
+                                // cell and component and that cell height is
+                                // below previous instance
+                                if (idx < 0 ||
+                                    dlst_ptr[idx] <= xm[dir] + 0.5 * dx[dir]) {
+                                    continue;
+                                }
+                                const bool linear_on =
+                                    use_linear && (xm[0] >= xhi - lx_linear);
                                 const bool use_linear_interp =
-                                    (has_overset && ibl_arr(i, j, k) == -1) ||
+                                    (has_overset && ibl_arr(iv) == -1) ||
                                     linear_on;
-                                const bool single_phase_above_interface = !(
-                                    multiphase || single_phase_below_interface);
-                                if (single_phase_below_interface) {
-                                    // put bdy at top
-                                    alpha = 1.0;
-                                    if (ni % 2 != 0) {
-                                        mx *= -1.0;
-                                        my *= -1.0;
-                                        mz *= -1.0;
-                                        alpha *= -1.0;
-                                    }
-                                    calc_flag = true;
-                                }
-                                // Multiphase cell case
-                                if (multiphase) {
-                                    if (!use_linear_interp) {
-                                        // Planar reconstruction
-                                        calc_flag = true;
-                                        multiphase::fit_plane(
-                                            i, j, k, vof_arr, mx, my, mz,
-                                            alpha);
-                                    } else {
-                                        // Interpolation (later)
-                                        calc_flag_diffuse = true;
+                                amrex::Real ht;
+                                if (cell_interface_height(
+                                        iv[0], iv[1], iv[2], ni, dir, gc0, gc1,
+                                        loc_arr(iv, 2 * n),
+                                        loc_arr(iv, 2 * n + 1),
+                                        use_linear_interp, vof_arr, xm, dx, dxi,
+                                        plo[dir], ht)) {
+                                    if (idx_max < 0) {
+                                        m_stop = amrex::max(mlo, m - 1);
                                     }
+                                    ht_max = amrex::max(ht_max, ht);
+                                    idx_max = idx;
                                 }
-                                // Single-phase cell bordering other phase, does
-                                // not fit into other categories
-                                if (single_phase_above_interface &&
-                                    use_linear_interp) {
-                                    // With linear interp, interface can show up
-                                    // in single-phase cell
-                                    const amrex::IntVect iv{i, j, k};
-                                    amrex::IntVect iv_p = iv;
-                                    amrex::IntVect iv_m = iv;
-                                    iv_p[dir] += 1;
-                                    iv_m[dir] -= 1;
-                                    // Check for 0.5 intersect
-                                    const bool intersect_above =
-                                        (vof_arr(iv_p) - 0.5) *
-                                            (vof_arr(iv) - 0.5) <=
-                                        0;
-                                    const bool intersect_below =
-                                        (vof_arr(iv) - 0.5) *
-                                            (vof_arr(iv_m) - 0.5) <=
-                                        0;
-                                    calc_flag_diffuse =
-                                        calc_flag_diffuse || intersect_above;
-                                    calc_flag_diffuse =
-                                        calc_flag_diffuse || intersect_below;
-                                }
-
-                                // Initialize height measurement
-                                amrex::Real ht = plo[dir];
-                                if (calc_flag) {
-                                    // Reassign slope coefficients
-                                    const amrex::Real mdr =
-                                        (dir == 0) ? mx
-                                                   : ((dir == 1) ? my : mz);
-                                    const amrex::Real mg1 =
-                                        (dir == 0) ? my : mx;
-                                    const amrex::Real mg2 =
-                                        (dir == 2) ? my : mz;
-                                    // Get height of interface
-                                    if (mdr == 0) {
-                                        // If slope is undefined in z,
-                                        // use middle of cell
-                                        ht = xm[dir];
-                                    } else {
-                                        // Intersect 2D point with plane
-                                        ht = (xm[dir] - 0.5 * dx[dir]) +
-                                             (alpha -
-                                              mg1 * dxi[gc0] *
-                                                  (loc0 -
-                                                   (xm[gc0] - 0.5 * dx[gc0])) -
-                                              mg2 * dxi[gc1] *
-                                                  (loc1 -
-                                                   (xm[gc1] - 0.5 * dx[gc1]))) /
-                                                 (mdr * dxi[dir]);
-                                    }
-                                }
-                                if (calc_flag_diffuse) {
-                                    const amrex::Real dv_xl =
-                                        vof_arr(i, j, k) - vof_arr(i - 1, j, k);
-                                    const amrex::Real dv_xr =
-                                        vof_arr(i + 1, j, k) - vof_arr(i, j, k);
-                                    const amrex::Real dv_yl =
-                                        vof_arr(i, j, k) - vof_arr(i, j - 1, k);
-                                    const amrex::Real dv_yr =
-                                        vof_arr(i, j + 1, k) - vof_arr(i, j, k);
-                                    const amrex::Real dv_zl =
-                                        vof_arr(i, j, k) - vof_arr(i, j, k - 1);
-                                    const amrex::Real dv_zr =
-                                        vof_arr(i, j, k + 1) - vof_arr(i, j, k);
-                                    // Distances from cell center to probe loc
-                                    const amrex::Real dist_0 = loc0 - xm[gc0];
-                                    const amrex::Real dist_1 = loc1 - xm[gc1];
-                                    // Slopes on either side
-                                    amrex::Real slope_dir_r =
-                                        dir == 0 ? dv_xr
-                                                 : (dir == 1 ? dv_yr : dv_zr);
-                                    amrex::Real slope_dir_l =
-                                        dir == 0 ? dv_xl
-                                                 : (dir == 1 ? dv_yl : dv_zl);
-                                    // One-sided slopes for when sign of
-                                    // distance to interface is known
-                                    amrex::Real slope_0 =
-                                        dist_0 > 0 ? (dir == 0 ? dv_yr : dv_xr)
-                                                   : (dir == 0 ? dv_yl : dv_xl);
-                                    amrex::Real slope_1 =
-                                        dist_1 > 0 ? (dir == 2 ? dv_yr : dv_zr)
-                                                   : (dir == 2 ? dv_yl : dv_zl);
-                                    // Turn finite differences into true slopes
-                                    slope_dir_r *= dxi[dir];
-                                    slope_dir_l *= dxi[dir];
-                                    slope_0 *= dxi[gc0];
-                                    slope_1 *= dxi[gc1];
-                                    // Trilinear interpolation for vof
-                                    const amrex::Real vof_c = vof_arr(i, j, k) +
-                                                              slope_0 * dist_0 +
-                                                              slope_1 * dist_1;
-                                    // Extrapolate to cell edge (0.5) plus a
-                                    // factor of safety (0.1) because
-                                    // reconstruction is not identical in
-                                    // neighboring cells
-                                    const amrex::Real vof_r =
-                                        vof_c + 0.6 * slope_dir_r * dx[dir];
-                                    const amrex::Real vof_l =
-                                        vof_c - 0.6 * slope_dir_l * dx[dir];
-                                    // Check for intersect with 0.5
-                                    if ((vof_c - 0.5) * (vof_r - 0.5) <= 0.) {
-                                        ht = xm[dir] +
-                                             (0.5 - vof_c) /
-                                                 (slope_dir_r + constants::EPS);
-                                    } else if (
-                                        (vof_c - 0.5) * (vof_l - 0.5) <= 0.) {
-                                        ht = xm[dir] +
-                                             (0.5 - vof_c) /
-                                                 (slope_dir_l + constants::EPS);
-                                    } else {
-                                        // Skip if no intersection
-                                        ht = plo[dir];
-                                    }
-                                }
-
-                                if (calc_flag || calc_flag_diffuse) {
-                                    // If interface is below lower
-                                    // bound, continue to look
-                                    if (ht < xm[dir] - 0.5 * dx[dir]) {
-                                        ht = plo[dir];
-                                    }
-                                    // If interface is above upper
-                                    // bound, limit it
-                                    if (ht > xm[dir] +
-                                                 0.5 * dx[dir] * (1.0 + 1e-8)) {
-                                        ht = xm[dir] + 0.5 * dx[dir];
-                                    }
-                                    // Save interface location by atomic max
-                                    amrex::Gpu::Atomic::Max(&dout_ptr[idx], ht);
-                                }
+                            }
+                            if (idx_max >= 0) {
+                                // Save interface location by atomic max
+                                amrex::Gpu::Atomic::Max(
+                                    &out_ptr[idx_max], ht_max);
                             }
                         }
                     });
@@ -687,10 +731,17 @@ bool FreeSurfaceSampler::update_sampling_locations()
         amrex::Gpu::copy(
             amrex::Gpu::deviceToHost, dout.begin(), dout.end(),
             &m_out[static_cast<long>(ni) * m_npts]);
-        // Make consistent across parallelization
-        for (int n = 0; n < m_npts; n++) {
-            amrex::ParallelDescriptor::ReduceRealMax(m_out[ni * m_npts + n]);
+        // Merge the heights found by every thread
+        for (int nt = 0; (nthreads > 1) && (nt < nthreads); ++nt) {
+            for (int n = 0; n < m_npts; n++) {
+                m_out[ni * m_npts + n] = amrex::max(
+                    m_out[ni * m_npts + n],
+                    thread_out[static_cast<long>(nt) * m_npts + n]);
+            }
         }
+        // Make consistent across parallelization
+        amrex::ParallelDescriptor::ReduceRealMax(
+            &m_out[static_cast<long>(ni) * m_npts], m_npts);
         // Copy last m_out to device vector of results of last instance
         amrex::Gpu::copy(
             amrex::Gpu::hostToDevice, &m_out[static_cast<long>(ni) * m_npts],
@@ -751,13 +802,14 @@ void FreeSurfaceSampler::post_regrid_actions()
         const amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> phi =
             geom.ProbHiArray();
 #ifdef AMREX_USE_OMP
-#pragma omp parallel if (false)
+#pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
 #endif
-        for (amrex::MFIter mfi(floc(lev)); mfi.isValid(); ++mfi) {
+        for (amrex::MFIter mfi(floc(lev), amrex::TilingIfNotGPU());
+             mfi.isValid(); ++mfi) {
             auto loc_arr = floc(lev).array(mfi);
             auto idx_arr = fidx(lev).array(mfi);
             auto mask_arr = level_mask.const_array(mfi);
-            const auto& vbx = mfi.validbox();
+            const auto& vbx = mfi.tilebox();
             amrex::ParallelFor(
                 vbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
                     // Cell location
@@ -16,7 +16,16 @@ Sampling::Sampling(CFDSim& sim, std::string label)
     , m_label(std::move(label))
 {}
 
-Sampling::~Sampling() = default;
+Sampling::~Sampling()
+{
+#ifdef AMR_WIND_USE_NETCDF
+    // Write the output steps remaining in the buffer
+    if (m_ncf) {
+        flush_netcdf();
+        m_ncf.reset();
+    }
+#endif
+}
 
 void Sampling::initialize()
 {
@@ -48,6 +57,20 @@ void Sampling::initialize()
         pp.queryarr("derived_fields", derived_field_names);
         pp.query("output_format", m_out_fmt);
         pp.query("restart_sample", m_restart_sample);
+        pp.query("stencil_cache", m_use_stencil_cache);
+        pp.query("sparse_gather", m_sparse_gather);
+#ifdef AMR_WIND_USE_NETCDF
+        pp.query("netcdf_buffer_steps", m_nc_buffer_steps);
+        pp.query("netcdf_chunk_steps", m_nc_chunk_steps);
+        pp.query("netcdf_deflate_level", m_nc_deflate_level);
+        if (m_nc_buffer_steps < 1) {
+            amrex::Abort("Sampling: netcdf_buffer_steps must be at least 1");
+        }
+        if ((m_nc_deflate_level < 0) || (m_nc_deflate_level > 9)) {
+            amrex::Abort(
+                "Sampling: netcdf_deflate_level must be between 0 and 9");
+        }
+#endif
         populate_output_parameters(pp);
     }
 
@@ -119,12 +142,30 @@ void Sampling::initialize()
         m_samplers.emplace_back(std::move(obj));
     }
 
+    if (m_use_stencil_cache) {
+        if (m_out_fmt != "netcdf") {
+            amrex::Abort("Sampling: stencil_cache requires NetCDF output");
+        }
+        if (!std::all_of(
+                m_samplers.begin(), m_samplers.end(),
+                [](const auto& obj) { return obj->fixed_locations(); })) {
+            amrex::Abort(
+                "Sampling: stencil_cache requires samplers with fixed "
+                "locations");
+        }
+        m_stencil_cache = std::make_unique<SamplingStencilCache>(m_sim.mesh());
+    }
+
     update_container();
 
 #ifdef AMR_WIND_USE_NETCDF
     if (m_out_fmt == "netcdf") {
         prepare_netcdf_file();
-        m_sample_buf.assign(m_total_particles * m_var_names.size(), 0.0);
+        if (m_sparse_gather && !amrex::ParallelDescriptor::IOProcessor()) {
+            m_sample_buf.clear();
+        } else {
+            m_sample_buf.assign(m_total_particles * m_var_names.size(), 0.0);
+        }
     }
 #endif
 
@@ -145,6 +186,11 @@ void Sampling::update_container()
 {
     BL_PROFILE("amr-wind::Sampling::update_container");
 
+    if (m_stencil_cache) {
+        m_stencil_cache->build(m_samplers, m_ncomp + m_nicomp + m_ndcomp);
+        return;
+    }
+
     // Initialize the particle container based on user inputs
     m_scontainer = std::make_unique<SamplingContainer>(m_sim.mesh());
 
@@ -194,12 +240,21 @@ void Sampling::sampling_workflow()
 
     update_sampling_locations();
 
-    m_scontainer->interpolate_fields(m_fields, 0);
+    if (m_stencil_cache) {
+        m_stencil_cache->interpolate_fields(m_fields, 0);
 
-    m_scontainer->interpolate_fields(m_int_fields, m_ncomp);
+        m_stencil_cache->interpolate_fields(m_int_fields, m_ncomp);
 
-    m_scontainer->interpolate_derived_fields(
-        *m_derived_mgr, m_sim.repo(), m_ncomp + m_nicomp);
+        m_stencil_cache->interpolate_derived_fields(
+            *m_derived_mgr, m_sim.repo(), m_ncomp + m_nicomp);
+    } else {
+        m_scontainer->interpolate_fields(m_fields, 0);
+
+        m_scontainer->interpolate_fields(m_int_fields, m_ncomp);
+
+        m_scontainer->interpolate_derived_fields(
+            *m_derived_mgr, m_sim.repo(), m_ncomp + m_nicomp);
+    }
 
     fill_buffer();
 
@@ -232,7 +287,11 @@ void Sampling::post_regrid_actions()
         obj->post_regrid_actions();
     }
 
-    m_scontainer->Redistribute();
+    if (m_stencil_cache) {
+        m_stencil_cache->build(m_samplers, m_ncomp + m_nicomp + m_ndcomp);
+    } else {
+        m_scontainer->Redistribute();
+    }
 }
 
 void Sampling::convert_velocity_lineofsight()
@@ -243,6 +302,10 @@ void Sampling::convert_velocity_lineofsight()
         return;
     }
 
+    if (m_sparse_gather && !amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
 #ifdef AMR_WIND_USE_NETCDF
     amrex::Vector<int> vel_map(AMREX_SPACEDIM, 0);
     const amrex::Vector<std::string> vnames = {
@@ -274,7 +337,7 @@ void Sampling::convert_velocity_lineofsight()
                 long vel_off = vel_map[iv];
 
                 long offset =
-                    vel_off * m_scontainer->num_sampling_particles() + soffset;
+                    vel_off * static_cast<long>(m_total_particles) + soffset;
                 for (int j = 0; j < scan_size; ++j) {
                     temp_vel[j][iv] = m_sample_buf[offset + j];
                     if (obj->do_subsampling_interp()) {
@@ -305,10 +368,15 @@ void Sampling::create_output_buffer()
         return;
     }
 
+    // The sampled values are only available on the I/O processor
+    if (m_sparse_gather && !amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+
 #ifdef AMR_WIND_USE_NETCDF
     const long nvars = m_var_names.size();
     for (int iv = 0; iv < nvars; ++iv) {
-        long offset = iv * m_scontainer->num_sampling_particles();
+        long offset = iv * static_cast<long>(m_total_particles);
         for (const auto& obj : m_samplers) {
             long sample_size = obj->num_points();
             if (obj->do_data_modification()) {
@@ -344,7 +412,13 @@ void Sampling::fill_buffer()
     BL_PROFILE("amr-wind::Sampling::fill_buffer");
     if (m_out_fmt == "netcdf") {
 #ifdef AMR_WIND_USE_NETCDF
-        m_scontainer->populate_buffer(m_sample_buf);
+        if (m_stencil_cache) {
+            m_stencil_cache->populate_buffer(m_sample_buf);
+        } else if (m_sparse_gather) {
+            m_scontainer->gather_buffer(m_sample_buf);
+        } else {
+            m_scontainer->populate_buffer(m_sample_buf);
+        }
 #else
         amrex::Abort(
             "NetCDF support was not enabled during build time. Please "
@@ -510,20 +584,32 @@ void Sampling::prepare_netcdf_file()
         obj->define_netcdf_metadata(grp);
         grp.def_var("coordinates", NC_DOUBLE, {npart_name, "ndim"});
 
+        const auto def_sample_var = [&](const std::string& vname) {
+            auto var = grp.def_var(vname, NC_DOUBLE, two_dim);
+            if (m_nc_chunk_steps > 0) {
+                var.set_chunking(
+                    {static_cast<size_t>(m_nc_chunk_steps),
+                     static_cast<size_t>(obj->num_output_points())});
+            }
+            if (m_nc_deflate_level > 0) {
+                var.set_deflate(m_nc_deflate_level);
+            }
+        };
+
         // Create variables in each sampler
         // Removing velocity components when LOS velocity is output
         for (const std::string& vname : m_var_names) {
             if (!obj->do_convert_velocity_los()) {
-                grp.def_var(vname, NC_DOUBLE, two_dim);
+                def_sample_var(vname);
             } else {
                 if (vname.find("velocity") == std::string::npos) {
-                    grp.def_var(vname, NC_DOUBLE, two_dim);
+                    def_sample_var(vname);
                 }
             }
         }
 
         if (obj->do_convert_velocity_los()) {
-            grp.def_var("los_velocity", NC_DOUBLE, two_dim);
+            def_sample_var("los_velocity");
         }
     }
     ncf.exit_def_mode();
@@ -556,6 +642,10 @@ void Sampling::write_netcdf()
     if (!amrex::ParallelDescriptor::IOProcessor()) {
         return;
     }
+    if (m_nc_buffer_steps > 1) {
+        buffer_netcdf_step();
+        return;
+    }
     amrex::Print()
         << "WARNING: Sampling: netcdf output will negatively impact performance"
         << std::endl;
@@ -613,4 +703,87 @@ void Sampling::write_netcdf()
 #endif
 }
 
+void Sampling::buffer_netcdf_step()
+{
+#ifdef AMR_WIND_USE_NETCDF
+    BL_PROFILE("amr-wind::Sampling::buffer_netcdf_step");
+
+    if (!m_ncf) {
+        m_ncf = std::make_unique<ncutils::NCFile>(
+            ncutils::NCFile::open(m_ncfile_name, NC_WRITE));
+        m_nc_next_step = m_ncf->dim("num_time_steps").len();
+    }
+
+    // Custom sampler output is written at every output step
+    const size_t nt = m_nc_next_step + m_nc_times.size();
+    for (const auto& obj : m_samplers) {
+        auto grp = m_ncf->group(obj->label());
+        obj->output_netcdf_data(grp, nt);
+        const bool custom_output =
+            obj->output_netcdf_field(m_output_buf, grp, nt);
+        AMREX_ALWAYS_ASSERT(custom_output);
+    }
+
+    // Standard sampler output, step after step for every variable
+    const auto nvars = m_var_names.size();
+    const auto nsamplers = m_samplers.size();
+    m_nc_values.resize(nvars * nsamplers);
+    for (int iv = 0; iv < nvars; ++iv) {
+        const std::string& vname = m_var_names[iv];
+        auto offset = iv * num_netcdf_output_particles();
+        for (int is = 0; is < nsamplers; ++is) {
+            const auto& obj = m_samplers[is];
+            const int count = static_cast<int>(obj->num_output_points());
+            if (!obj->do_convert_velocity_los() ||
+                (vname.find("velocity") == std::string::npos)) {
+                auto& values = m_nc_values[iv * nsamplers + is];
+                values.insert(
+                    values.end(), &m_output_buf[offset],
+                    &m_output_buf[offset] + count);
+            }
+            offset += count;
+        }
+    }
+    m_nc_times.push_back(m_sim.time().new_time());
+
+    if (m_nc_times.size() >= static_cast<size_t>(m_nc_buffer_steps)) {
+        flush_netcdf();
+    }
+#endif
+}
+
+void Sampling::flush_netcdf()
+{
+#ifdef AMR_WIND_USE_NETCDF
+    if (m_nc_times.empty()) {
+        return;
+    }
+    BL_PROFILE("amr-wind::Sampling::flush_netcdf");
+
+    const size_t nt = m_nc_next_step;
+    const size_t nsteps = m_nc_times.size();
+    m_ncf->var("time").put(m_nc_times.data(), {nt}, {nsteps});
+
+    // One write of all the buffered steps for every variable
+    const auto nsamplers = m_samplers.size();
+    for (int iv = 0; iv < m_var_names.size(); ++iv) {
+        for (int is = 0; is < nsamplers; ++is) {
+            const auto& values = m_nc_values[iv * nsamplers + is];
+            if (values.empty()) {
+                continue;
+            }
+            const auto& obj = m_samplers[is];
+            auto grp = m_ncf->group(obj->label());
+            const auto npts = static_cast<size_t>(obj->num_output_points());
+            grp.var(m_var_names[iv])
+                .put(values.data(), {nt, 0}, {nsteps, npts});
+        }
+    }
+
+    m_nc_next_step += nsteps;
+    m_nc_times.clear();
+    m_nc_values.clear();
+#endif
+}
+
 } // namespace amr_wind::sampling
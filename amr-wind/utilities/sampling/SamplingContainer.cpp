@@ -3,6 +3,8 @@
 #include "amr-wind/utilities/sampling/SamplerBase.H"
 #include "amr-wind/core/Field.H"
 
+#include <numeric>
+
 namespace amr_wind::sampling {
 
 void SamplingContainer::setup_container(
@@ -194,4 +196,82 @@ void SamplingContainer::populate_buffer(std::vector<double>& buf)
         amrex::ParallelDescriptor::IOProcessorNumber());
 }
 
+void SamplingContainer::gather_buffer(std::vector<double>& buf)
+{
+    BL_PROFILE("amr-wind::SamplingContainer::gather_buffer");
+
+    // Unique ID followed by the values of every local particle
+    const int nvars = NumRuntimeRealComps();
+    const int stride = nvars + 1;
+    const int nlevels = m_mesh.finestLevel() + 1;
+    int num_local = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            num_local += pti.numParticles();
+        }
+    }
+
+    amrex::Gpu::DeviceVector<double> dbuf(
+        static_cast<long>(num_local) * stride);
+    auto* dbuf_ptr = dbuf.data();
+    long offset = 0;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
+            const int np = pti.numParticles();
+            auto* pstruct = pti.GetArrayOfStructs()().data();
+            auto* dst = dbuf_ptr + offset;
+            offset += static_cast<long>(np) * stride;
+            amrex::ParallelFor(
+                np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                    dst[ip * stride] = pstruct[ip].idata(IIx::uid);
+                });
+            for (int fid = 0; fid < nvars; ++fid) {
+                const auto* parr =
+                    pti.GetStructOfArrays().GetRealData(fid).data();
+                amrex::ParallelFor(
+                    np, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+                        dst[ip * stride + fid + 1] = parr[ip];
+                    });
+            }
+        }
+    }
+
+    amrex::Vector<double> values(dbuf.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, dbuf.begin(), dbuf.end(), values.begin());
+
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const bool is_ioproc = amrex::ParallelDescriptor::IOProcessor();
+    const int count = static_cast<int>(values.size());
+    std::vector<int> counts(nprocs, 0);
+    std::vector<int> displs(nprocs, 0);
+    amrex::ParallelDescriptor::Gather(&count, 1, counts.data(), 1, ioproc);
+    if (is_ioproc) {
+        std::partial_sum(
+            counts.begin(), counts.end() - 1, displs.begin() + 1);
+    }
+
+    amrex::Vector<double> all_values(
+        is_ioproc ? displs.back() + counts.back() : 0);
+    amrex::ParallelDescriptor::Gatherv(
+        values.data(), count, all_values.data(), counts, displs, ioproc);
+
+    if (!is_ioproc) {
+        return;
+    }
+
+    // Points outside the mesh are not sampled
+    std::fill(buf.begin(), buf.end(), 0.0);
+    const long num_points = num_sampling_particles();
+    const long num_all = all_values.size() / stride;
+    for (long ip = 0; ip < num_all; ++ip) {
+        const double* pval = &all_values[ip * stride];
+        const auto uid = static_cast<long>(pval[0]);
+        for (int n = 0; n < nvars; ++n) {
+            buf[n * num_points + uid] = pval[n + 1];
+        }
+    }
+}
+
 } // namespace amr_wind::sampling
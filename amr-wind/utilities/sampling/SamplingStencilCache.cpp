@@ -0,0 +1,246 @@
+#include "amr-wind/utilities/sampling/SamplingStencilCache.H"
+#include "amr-wind/utilities/sampling/SamplerBase.H"
+#include "amr-wind/core/FieldRepo.H"
+
+#include <cmath>
+#include <numeric>
+
+namespace amr_wind::sampling {
+
+void SamplingStencilCache::build(
+    const amrex::Vector<std::unique_ptr<SamplerBase>>& samplers,
+    const int num_vars)
+{
+    BL_PROFILE("amr-wind::SamplingStencilCache::build");
+
+    m_nlevels = m_mesh.finestLevel() + 1;
+    m_num_vars = num_vars;
+    m_stencils.clear();
+
+    // Unique IDs follow the same convention as SamplingContainer
+    amrex::Vector<amrex::RealVect> locs;
+    amrex::Vector<int> uids;
+    m_total_points = 0;
+    for (const auto& probe : samplers) {
+        SampleLocType sample_locs;
+        probe->sampling_locations(sample_locs);
+        const auto& plocs = sample_locs.locations();
+        const auto& ids = sample_locs.ids();
+        for (int n = 0; n < plocs.size(); ++n) {
+            locs.push_back(plocs[n]);
+            uids.push_back(static_cast<int>(ids[n] + m_total_points));
+        }
+        m_total_points += probe->num_points();
+    }
+
+    // Assign every point to the box that contains it on the finest level
+    const int npts = static_cast<int>(locs.size());
+    amrex::Vector<int> point_level(npts, -1);
+    amrex::Vector<int> point_box(npts, -1);
+    amrex::Vector<amrex::Vector<int>> local_index(m_nlevels);
+    amrex::Vector<int> num_local_boxes(m_nlevels, 0);
+    for (int lev = m_nlevels - 1; lev >= 0; --lev) {
+        const auto& ba = m_mesh.boxArray(lev);
+        const auto& dm = m_mesh.DistributionMap(lev);
+        local_index[lev].assign(ba.size(), -1);
+        for (amrex::MFIter mfi(ba, dm); mfi.isValid(); ++mfi) {
+            local_index[lev][mfi.index()] = mfi.LocalIndex();
+            ++num_local_boxes[lev];
+        }
+
+        const auto& geom = m_mesh.Geom(lev);
+        const auto& plo = geom.ProbLoArray();
+        const auto& phi = geom.ProbHiArray();
+        const auto& dxinv = geom.InvCellSizeArray();
+        const auto& dom_hi = geom.Domain().bigEnd();
+        for (int ip = 0; ip < npts; ++ip) {
+            if (point_level[ip] >= 0) {
+                continue;
+            }
+            amrex::IntVect iv;
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                iv[d] = static_cast<int>(
+                    std::floor((locs[ip][d] - plo[d]) * dxinv[d]));
+                // Points on the high face of the domain belong to the last
+                // cell
+                if (locs[ip][d] <= phi[d]) {
+                    iv[d] = amrex::min(iv[d], dom_hi[d]);
+                }
+            }
+            const auto isects = ba.intersections(amrex::Box(iv, iv), true, 0);
+            if (!isects.empty()) {
+                point_level[ip] = lev;
+                point_box[ip] = local_index[lev][isects[0].first];
+            }
+        }
+    }
+
+    // Order the local points by level and box
+    m_box_offsets.resize(m_nlevels);
+    m_locs.clear();
+    m_levels.clear();
+    m_uids.clear();
+    amrex::Vector<amrex::Vector<amrex::Vector<int>>> box_points(m_nlevels);
+    for (int lev = 0; lev < m_nlevels; ++lev) {
+        box_points[lev].resize(num_local_boxes[lev]);
+    }
+    int num_located = 0;
+    for (int ip = 0; ip < npts; ++ip) {
+        if (point_level[ip] < 0) {
+            continue;
+        }
+        ++num_located;
+        if (point_box[ip] >= 0) {
+            box_points[point_level[ip]][point_box[ip]].push_back(ip);
+        }
+    }
+    for (int lev = 0; lev < m_nlevels; ++lev) {
+        auto& offsets = m_box_offsets[lev];
+        offsets.assign(num_local_boxes[lev] + 1, 0);
+        for (int li = 0; li < num_local_boxes[lev]; ++li) {
+            offsets[li] = static_cast<int>(m_uids.size());
+            for (const int ip : box_points[lev][li]) {
+                m_locs.push_back(locs[ip]);
+                m_levels.push_back(lev);
+                m_uids.push_back(uids[ip]);
+            }
+        }
+        offsets[num_local_boxes[lev]] = static_cast<int>(m_uids.size());
+    }
+    if (num_located < m_total_points) {
+        amrex::Print() << "WARNING: SamplingStencilCache: "
+                       << m_total_points - num_located
+                       << " sampling points outside the domain are not sampled"
+                       << std::endl;
+    }
+
+    m_values.resize(m_uids.size() * m_num_vars);
+
+    // The I/O processor needs the unique IDs of the points of every process
+    // to assemble the output buffer
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int nlocal = num_local_points();
+    m_proc_points.resize(nprocs);
+    amrex::ParallelDescriptor::Gather(
+        &nlocal, 1, m_proc_points.data(), ioproc);
+
+    std::vector<int> counts(m_proc_points.begin(), m_proc_points.end());
+    std::vector<int> displs(nprocs, 0);
+    std::partial_sum(counts.begin(), counts.end() - 1, displs.begin() + 1);
+    m_all_uids.resize(
+        amrex::ParallelDescriptor::IOProcessor() ? num_located : 0);
+    amrex::ParallelDescriptor::Gatherv(
+        m_uids.data(), nlocal, m_all_uids.data(), counts, displs, ioproc);
+}
+
+const amrex::Gpu::DeviceVector<SamplingStencilCache::Stencil>&
+SamplingStencilCache::get_stencils(const FieldLoc floc)
+{
+    auto found = m_stencils.find(floc);
+    if (found != m_stencils.end()) {
+        return found->second;
+    }
+
+    BL_PROFILE("amr-wind::SamplingStencilCache::get_stencils");
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> offset{0.5, 0.5, 0.5};
+    switch (floc) {
+    case FieldLoc::NODE:
+        offset = {0.0, 0.0, 0.0};
+        break;
+    case FieldLoc::CELL:
+        break;
+    case FieldLoc::XFACE:
+        offset[0] = 0.0;
+        break;
+    case FieldLoc::YFACE:
+        offset[1] = 0.0;
+        break;
+    case FieldLoc::ZFACE:
+        offset[2] = 0.0;
+        break;
+    }
+
+    const int npts = num_local_points();
+    amrex::Vector<Stencil> stencils(npts);
+    for (int ip = 0; ip < npts; ++ip) {
+        const auto& geom = m_mesh.Geom(m_levels[ip]);
+        const auto& plo = geom.ProbLoArray();
+        const auto& dx = geom.CellSizeArray();
+        const auto& dxi = geom.InvCellSizeArray();
+
+        amrex::Real xi[AMREX_SPACEDIM];
+        int idx[AMREX_SPACEDIM];
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            xi[d] = (m_locs[ip][d] - plo[d] - offset[d] * dx[d]) * dxi[d];
+            idx[d] = static_cast<int>(std::floor(xi[d]));
+        }
+        stencils[ip] = Stencil{idx[0],         idx[1],         idx[2],
+                               xi[0] - idx[0], xi[1] - idx[1], xi[2] - idx[2]};
+    }
+
+    auto& dstencils = m_stencils[floc];
+    dstencils.resize(npts);
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, stencils.begin(), stencils.end(),
+        dstencils.begin());
+    return dstencils;
+}
+
+void SamplingStencilCache::interpolate_derived_fields(
+    const DerivedQtyMgr& derived_mgr, const FieldRepo& repo, const int scomp)
+{
+    BL_PROFILE("amr-wind::SamplingStencilCache::interpolate_derived_fields");
+
+    auto outfield = repo.create_scratch_field(derived_mgr.num_comp(), 1);
+    derived_mgr(*outfield, 0);
+
+    for (int lev = 0; lev < m_nlevels; ++lev) {
+        interpolate(
+            (*outfield)(lev), lev, outfield->field_location(),
+            outfield->num_comp(), scomp);
+    }
+}
+
+void SamplingStencilCache::populate_buffer(std::vector<double>& buf)
+{
+    BL_PROFILE("amr-wind::SamplingStencilCache::populate_buffer");
+
+    amrex::Vector<amrex::Real> values(m_values.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, m_values.begin(), m_values.end(),
+        values.begin());
+
+    const int ioproc = amrex::ParallelDescriptor::IOProcessorNumber();
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const bool is_ioproc = amrex::ParallelDescriptor::IOProcessor();
+    std::vector<int> counts(nprocs, 0);
+    std::vector<int> displs(nprocs, 0);
+    if (is_ioproc) {
+        for (int ip = 0; ip < nprocs; ++ip) {
+            counts[ip] = m_proc_points[ip] * m_num_vars;
+        }
+        std::partial_sum(
+            counts.begin(), counts.end() - 1, displs.begin() + 1);
+    }
+
+    // Points that were not located keep their value in the buffer
+    const long num_located = static_cast<long>(m_all_uids.size());
+    amrex::Vector<amrex::Real> all_values(num_located * m_num_vars);
+    amrex::ParallelDescriptor::Gatherv(
+        values.data(), static_cast<int>(values.size()), all_values.data(),
+        counts, displs, ioproc);
+
+    if (!is_ioproc) {
+        return;
+    }
+
+    for (long ip = 0; ip < num_located; ++ip) {
+        const long uid = m_all_uids[ip];
+        for (int n = 0; n < m_num_vars; ++n) {
+            buf[n * m_total_points + uid] = all_values[ip * m_num_vars + n];
+        }
+    }
+}
+
+} // namespace amr_wind::sampling
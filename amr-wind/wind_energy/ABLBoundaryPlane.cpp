@@ -257,6 +257,48 @@ void InletData::read_data_native(
     bndry.copyTo((*m_data_np1[ori])[lev], 0, nstart, static_cast<int>(nc));
 }
 
+void InletData::read_data_native(
+    const amrex::Orientation ori,
+    const amrex::Vector<amrex::FArrayBox>& bndry_fabs,
+    const int lev,
+    const Field* fld,
+    const bool np1)
+{
+    const int nc = fld->num_comp();
+    const int nstart = m_components[static_cast<int>(fld->id())];
+
+    auto& dat = np1 ? (*m_data_np1[ori])[lev] : (*m_data_n[ori])[lev];
+    const auto& bbx = dat.box();
+    const auto& dat_arr = dat.array();
+    const amrex::IntVect v_offset = offset(ori.faceDir(), ori.coordDir());
+
+    for (const auto& fab : bndry_fabs) {
+        AMREX_ALWAYS_ASSERT(fab.nComp() == nc);
+
+        const auto& bx = bbx & fab.box();
+        if (bx.isEmpty()) {
+            continue;
+        }
+
+        const auto& bndry_arr = fab.const_array();
+        amrex::ParallelFor(
+            bx, nc, [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) noexcept {
+                dat_arr(i, j, k, nstart + n) =
+                    0.5 *
+                    (bndry_arr(i, j, k, n) +
+                     bndry_arr(
+                         i + v_offset[0], j + v_offset[1], k + v_offset[2], n));
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+void InletData::shift_data()
+{
+    std::swap(m_data_n, m_data_np1);
+    m_tn = m_tnp1;
+}
+
 void InletData::interpolate(const amrex::Real time)
 {
     m_tinterp = time;
@@ -315,6 +357,9 @@ ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
     pp.queryarr("bndry_var_names", m_var_names);
     pp.get("bndry_file", m_filename);
     pp.query("bndry_output_format", m_out_fmt);
+    pp.query("bndry_prefetch_depth", m_prefetch_depth);
+    pp.query("bndry_async_read", m_async_read);
+    pp.query("bndry_output_steps_per_file", m_steps_per_file);
 
 #ifndef AMR_WIND_USE_NETCDF
     if (m_out_fmt == "netcdf") {
@@ -326,7 +371,7 @@ ABLBoundaryPlane::ABLBoundaryPlane(CFDSim& sim)
     }
 #endif
 
-    if (!((m_out_fmt == "native") || (m_out_fmt == "netcdf") ||
+    if (!(is_native_format() || (m_out_fmt == "netcdf") ||
           (m_out_fmt == "erf-multiblock"))) {
         amrex::Print() << "Warning: boundary output format not recognized, "
                           "changing to native format"
@@ -520,12 +565,19 @@ void ABLBoundaryPlane::write_header()
 
 #endif
 
-    if (amrex::ParallelDescriptor::IOProcessor() && m_out_fmt == "native") {
+    if (amrex::ParallelDescriptor::IOProcessor() && is_native_format()) {
         // generate time file
         amrex::UtilCreateCleanDirectory(m_filename, false);
         std::ofstream oftime(m_time_file, std::ios::out);
         oftime.close();
     }
+
+    if (m_out_fmt == "native-chunked") {
+        // All ranks write into the directory created above
+        amrex::ParallelDescriptor::Barrier();
+        m_native_writer = std::make_unique<ABLBoundaryPlaneWriter>(
+            m_filename, m_steps_per_file);
+    }
 }
 
 void ABLBoundaryPlane::write_bndry_native_header(const std::string& chkname)
@@ -732,6 +784,91 @@ void ABLBoundaryPlane::write_file()
             }
         }
     }
+
+    if (m_out_fmt == "native-chunked") {
+        write_native_chunked(t_step);
+    }
+}
+
+/** Write the boundary data in the chunked native format
+ *
+ *  Unlike the native format, the faces are not gathered on a single rank.
+ *  Each rank stages the parts of the faces adjacent to the grids it owns and
+ *  writes them to its own file every `bndry_output_steps_per_file` outputs.
+ *
+ *  \param t_step Time step index
+ */
+void ABLBoundaryPlane::write_native_chunked(const int t_step)
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlane::write_native_chunked");
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ofstream oftime(m_time_file, std::ios::out | std::ios::app);
+        oftime << t_step << ' ' << std::setprecision(17) << m_time.new_time()
+               << '\n';
+        oftime.close();
+    }
+
+    const int nlevels = m_repo.num_active_levels();
+    const std::string level_prefix = "Level_";
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& ba = m_mesh.boxArray(lev);
+        const auto& dm = m_mesh.DistributionMap(lev);
+        const amrex::Box& minBox = ba.minimalBox();
+
+        for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+            auto ori = oit();
+            const std::string plane = m_plane_names[ori];
+
+            if (std::find(m_planes.begin(), m_planes.end(), plane) ==
+                m_planes.end()) {
+                continue;
+            }
+
+            // Faces of the grids that touch the boundary, owned by the rank
+            // that owns the grid so that the copy below is mostly local
+            const int normal = ori.coordDir();
+            amrex::BoxList face_boxes;
+            amrex::Vector<int> face_procs;
+            for (int i = 0; i < ba.size(); ++i) {
+                const amrex::Box& bx = ba[i];
+                if (ori.isLow() &&
+                    (bx.smallEnd(normal) == minBox.smallEnd(normal))) {
+                    face_boxes.push_back(
+                        amrex::adjCellLo(bx, normal, m_out_rad)
+                            .growHi(normal, m_in_rad));
+                    face_procs.push_back(dm[i]);
+                } else if (
+                    ori.isHigh() &&
+                    (bx.bigEnd(normal) == minBox.bigEnd(normal))) {
+                    face_boxes.push_back(
+                        amrex::adjCellHi(bx, normal, m_out_rad)
+                            .growLo(normal, m_in_rad));
+                    face_procs.push_back(dm[i]);
+                }
+            }
+            const amrex::BoxArray face_ba(std::move(face_boxes));
+            const amrex::DistributionMapping face_dm(std::move(face_procs));
+
+            for (auto* fld : m_fields) {
+                auto& field = *fld;
+                const auto& geom = field.repo().mesh().Geom();
+
+                amrex::MultiFab face_mf(face_ba, face_dm, field.num_comp(), 0);
+                face_mf.setVal(1.0e13);
+                face_mf.ParallelCopy(
+                    field(lev), 0, 0, field.num_comp(), 0, 0,
+                    geom[lev].periodicity());
+
+                const std::string filename = amrex::MultiFabFileFullPrefix(
+                    lev, "", level_prefix, field.name());
+                m_native_writer->stage(
+                    t_step, amrex::Concatenate(filename + '_', ori, 1),
+                    face_mf);
+            }
+        }
+    }
+
+    m_native_writer->end_step(t_step, nlevels);
 }
 
 void ABLBoundaryPlane::read_header()
@@ -830,7 +967,7 @@ void ABLBoundaryPlane::read_header()
     }
 #endif
 
-    if (m_out_fmt == "native") {
+    if (is_native_format()) {
 
         int time_file_length = 0;
 
@@ -880,6 +1017,7 @@ void ABLBoundaryPlane::read_header()
             nc += fld->num_comp();
         }
 
+        const int nlevels = boundary_native_file_levels();
         for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
             auto ori = oit();
 
@@ -894,7 +1032,6 @@ void ABLBoundaryPlane::read_header()
 
             m_in_data.define_plane(ori);
 
-            const int nlevels = boundary_native_file_levels();
             for (int lev = 0; lev < nlevels; ++lev) {
 
                 const amrex::Box& minBox = m_mesh.boxArray(lev).minimalBox();
@@ -908,6 +1045,45 @@ void ABLBoundaryPlane::read_header()
                 m_in_data.define_level_data(ori, pbx, nc);
             }
         }
+
+        // Validate the boundary file headers against the mesh once
+        if (m_out_fmt == "native") {
+            read_bndry_native_boxarrays(
+                m_filename +
+                    amrex::Concatenate("/bndry_output", m_in_timesteps[0]),
+                *(m_fields[0]));
+        }
+
+        // List of faces that are read at every time
+        const std::string level_prefix = "Level_";
+        amrex::Vector<std::string> face_names;
+        m_native_faces.clear();
+        for (int lev = 0; lev < nlevels; ++lev) {
+            for (int ifld = 0; ifld < m_fields.size(); ++ifld) {
+                const auto& field = *m_fields[ifld];
+                const std::string filename = amrex::MultiFabFileFullPrefix(
+                    lev, "", level_prefix, field.name());
+
+                for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+                    auto ori = oit();
+                    if ((!m_in_data.is_populated(ori)) ||
+                        ((field.bc_type()[ori] != BC::mass_inflow) &&
+                         (field.bc_type()[ori] != BC::mass_inflow_outflow))) {
+                        continue;
+                    }
+
+                    face_names.push_back(
+                        amrex::Concatenate(filename + '_', ori, 1));
+                    m_native_faces.push_back({lev, ifld, ori});
+                }
+            }
+        }
+
+        if (amrex::ParallelDescriptor::IOProcessor()) {
+            m_native_reader = std::make_unique<ABLBoundaryPlaneReader>(
+                m_filename, face_names, m_in_timesteps, m_prefetch_depth,
+                m_async_read, m_out_fmt == "native-chunked");
+        }
     } else if (m_out_fmt == "erf-multiblock") {
 
         m_in_times.push_back(-1.0e13); // create space for storing time at erf
@@ -1215,12 +1391,10 @@ void ABLBoundaryPlane::read_file(const bool nph_target_time)
 
 #endif
 
-    if (m_out_fmt == "native") {
+    if (is_native_format()) {
 
         const int index =
             utils::closest_index(m_in_times, time, constants::LOOSE_TOL);
-        const int t_step1 = m_in_timesteps[index];
-        const int t_step2 = m_in_timesteps[index + 1];
 
         if (!(m_in_times[index] <= time + constants::LOOSE_TOL) ||
             !(time <= m_in_times[index + 1] + constants::LOOSE_TOL)) {
@@ -1243,63 +1417,77 @@ void ABLBoundaryPlane::read_file(const bool nph_target_time)
                 ", index + 1 = " + std::to_string(index + 1));
         }
 
-        const std::string chkname1 =
-            m_filename + amrex::Concatenate("/bndry_output", t_step1);
-        const std::string chkname2 =
-            m_filename + amrex::Concatenate("/bndry_output", t_step2);
-
-        const std::string level_prefix = "Level_";
-
-        const int nlevels = boundary_native_file_levels();
-        const auto bndry_bas =
-            read_bndry_native_boxarrays(chkname1, *(m_fields[0]));
-        for (int lev = 0; lev < nlevels; ++lev) {
-            for (auto* fld : m_fields) {
-                auto& field = *fld;
-
-                const auto& ba = bndry_bas[lev];
-                amrex::DistributionMapping dm{ba};
-
-                amrex::BndryRegister bndry1(
-                    ba, dm, m_in_rad, m_out_rad, m_extent_rad,
-                    field.num_comp());
-                amrex::BndryRegister bndry2(
-                    ba, dm, m_in_rad, m_out_rad, m_extent_rad,
-                    field.num_comp());
-
-                bndry1.setVal(1.0e13);
-                bndry2.setVal(1.0e13);
+        // Reuse the data at n+1 when moving to the next interval so that
+        // only one new time is read
+        if ((m_native_index >= 0) && (index == m_native_index + 1)) {
+            m_in_data.shift_data();
+        } else {
+            read_native_slice(index, false);
+        }
+        read_native_slice(index + 1, true);
 
-                std::string filename1 = amrex::MultiFabFileFullPrefix(
-                    lev, chkname1, level_prefix, field.name());
-                std::string filename2 = amrex::MultiFabFileFullPrefix(
-                    lev, chkname2, level_prefix, field.name());
+        m_in_data.set_times(m_in_times[index], m_in_times[index + 1]);
+        m_native_index = index;
+    }
 
-                for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
-                    auto ori = oit();
+    m_in_data.interpolate(time);
+}
 
-                    if ((!m_in_data.is_populated(ori)) ||
-                        ((field.bc_type()[ori] != BC::mass_inflow) &&
-                         (field.bc_type()[ori] != BC::mass_inflow_outflow))) {
-                        continue;
-                    }
+/** Read the native boundary data at an index of the time table
+ *
+ *  The IO processor obtains the slice from the (prefetching) reader and
+ *  broadcasts the face data to all ranks.
+ *
+ *  \param idx Index in the time table
+ *  \param np1 Flag indicating if the data is stored at n+1 or n
+ */
+void ABLBoundaryPlane::read_native_slice(const int idx, const bool np1)
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlane::read_native_slice");
+    const bool is_io = amrex::ParallelDescriptor::IOProcessor();
+    const int root = amrex::ParallelDescriptor::IOProcessorNumber();
+
+    BndryPlaneSlice slice;
+    if (is_io) {
+        slice = m_native_reader->get(idx);
+    } else {
+        slice.faces.resize(m_native_faces.size());
+    }
 
-                    std::string facename1 =
-                        amrex::Concatenate(filename1 + '_', ori, 1);
-                    std::string facename2 =
-                        amrex::Concatenate(filename2 + '_', ori, 1);
+    for (int iface = 0; iface < m_native_faces.size(); ++iface) {
+        const auto& face = m_native_faces[iface];
+        auto& fabs = slice.faces[iface];
 
-                    bndry1[ori].read(facename1);
-                    bndry2[ori].read(facename2);
+        int nfabs = static_cast<int>(fabs.size());
+        amrex::ParallelDescriptor::Bcast(&nfabs, 1, root);
+        if (!is_io) {
+            fabs.resize(nfabs);
+        }
 
-                    m_in_data.read_data_native(
-                        oit, bndry1, bndry2, lev, fld, time, m_in_times);
+        for (auto& fab : fabs) {
+            amrex::Array<int, 2 * AMREX_SPACEDIM + 1> meta{0};
+            if (is_io) {
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    meta[d] = fab.box().smallEnd(d);
+                    meta[AMREX_SPACEDIM + d] = fab.box().bigEnd(d);
                 }
+                meta[2 * AMREX_SPACEDIM] = fab.nComp();
             }
+            amrex::ParallelDescriptor::Bcast(meta.data(), meta.size(), root);
+            if (!is_io) {
+                const amrex::Box bx(
+                    amrex::IntVect(meta.data()),
+                    amrex::IntVect(meta.data() + AMREX_SPACEDIM));
+                fab.resize(
+                    bx, meta[2 * AMREX_SPACEDIM], amrex::The_Pinned_Arena());
+            }
+            amrex::ParallelDescriptor::Bcast(
+                fab.dataPtr(), static_cast<size_t>(fab.size()), root);
         }
-    }
 
-    m_in_data.interpolate(time);
+        m_in_data.read_data_native(
+            face.ori, fabs, face.lev, m_fields[face.field_idx], np1);
+    }
 }
 
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
@@ -1549,6 +1737,26 @@ void ABLBoundaryPlane::impl_buffer_field(
 int ABLBoundaryPlane::boundary_native_file_levels() const
 {
     int nlevels = 0;
+    if (m_out_fmt == "native-chunked") {
+        // Levels are recorded with every chunk, the first one is used
+        if (amrex::ParallelDescriptor::IOProcessor()) {
+            std::ifstream chunks_file(m_filename + "/chunks.dat");
+            int first_step = 0;
+            int last_step = 0;
+            int nprocs = 0;
+            if (!(chunks_file >> first_step >> last_step >> nprocs >>
+                  nlevels)) {
+                amrex::Abort(
+                    "ABLBoundaryPlane: cannot read " + m_filename +
+                    "/chunks.dat");
+            }
+        }
+        amrex::ParallelDescriptor::Bcast(
+            &nlevels, 1, amrex::ParallelDescriptor::IOProcessorNumber(),
+            amrex::ParallelDescriptor::Communicator());
+        return std::min(nlevels, m_repo.num_active_levels());
+    }
+
     const std::string chkname =
         m_filename + amrex::Concatenate("/bndry_output", m_in_timesteps[0]);
     for (int lev = 0; lev < m_repo.num_active_levels(); ++lev) {
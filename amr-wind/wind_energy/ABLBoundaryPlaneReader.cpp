@@ -0,0 +1,329 @@
+#include "amr-wind/wind_energy/ABLBoundaryPlaneReader.H"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "AMReX_Arena.H"
+#include "AMReX_BLProfiler.H"
+#include "AMReX_Print.H"
+#include "AMReX_Utility.H"
+#include "AMReX_VisMF.H"
+
+namespace amr_wind {
+
+ABLBoundaryPlaneReader::ABLBoundaryPlaneReader(
+    std::string dirname,
+    amrex::Vector<std::string> face_names,
+    amrex::Vector<int> timesteps,
+    const int depth,
+    const bool async,
+    const bool chunked)
+    : m_dirname(std::move(dirname))
+    , m_face_names(std::move(face_names))
+    , m_timesteps(std::move(timesteps))
+    , m_depth(depth)
+    , m_async(async)
+    , m_chunked(chunked)
+{
+    if (m_chunked) {
+        for (int i = 0; i < m_face_names.size(); ++i) {
+            m_face_ids[m_face_names[i]] = i;
+        }
+
+        const std::string chunks_name = m_dirname + "/chunks.dat";
+        std::ifstream chunks_file(chunks_name);
+        if (!chunks_file.good()) {
+            amrex::Abort("ABLBoundaryPlaneReader: cannot open " + chunks_name);
+        }
+        ChunkInfo info{};
+        int nlevels = 0;
+        while (chunks_file >> info.first_step >> info.last_step >>
+               info.nprocs >> nlevels) {
+            m_chunks.push_back(info);
+        }
+    }
+
+    if (m_async) {
+        m_thread = std::thread(&ABLBoundaryPlaneReader::worker, this);
+    }
+}
+
+ABLBoundaryPlaneReader::~ABLBoundaryPlaneReader()
+{
+    if (m_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+}
+
+BndryPlaneSlice ABLBoundaryPlaneReader::get(const int idx)
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlaneReader::get");
+    AMREX_ALWAYS_ASSERT((idx >= 0) && (idx < m_timesteps.size()));
+
+    BndryPlaneSlice slice;
+    if (!m_async) {
+        try {
+            slice = read_slice(idx);
+        } catch (const std::exception& err) {
+            amrex::Abort(err.what());
+        }
+        return slice;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // Slices before the requested one will not be used anymore
+        m_slices.erase(m_slices.begin(), m_slices.lower_bound(idx));
+        for (auto it = m_queue.begin(); it != m_queue.end();) {
+            if (*it < idx) {
+                m_pending.erase(*it);
+                it = m_queue.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        if ((m_slices.count(idx) == 0) && (m_pending.count(idx) == 0)) {
+            m_queue.push_front(idx);
+            m_pending.insert(idx);
+            m_cv.notify_all();
+        }
+
+        m_cv.wait(lock, [this, idx] {
+            return (m_slices.count(idx) > 0) || !m_error.empty();
+        });
+        if (!m_error.empty()) {
+            lock.unlock();
+            amrex::Abort(m_error);
+        }
+
+        slice = std::move(m_slices[idx]);
+        m_slices.erase(idx);
+
+        const int last =
+            std::min(idx + m_depth, static_cast<int>(m_timesteps.size()) - 1);
+        for (int i = idx + 1; i <= last; ++i) {
+            queue(i);
+        }
+    }
+    m_cv.notify_all();
+
+    return slice;
+}
+
+void ABLBoundaryPlaneReader::queue(const int idx)
+{
+    if ((m_slices.count(idx) == 0) && (m_pending.count(idx) == 0)) {
+        m_queue.push_back(idx);
+        m_pending.insert(idx);
+    }
+}
+
+void ABLBoundaryPlaneReader::worker()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+        if (m_stop) {
+            break;
+        }
+
+        const int idx = m_queue.front();
+        m_queue.pop_front();
+        lock.unlock();
+
+        BndryPlaneSlice slice;
+        std::string error;
+        try {
+            slice = read_slice(idx);
+        } catch (const std::exception& err) {
+            error = err.what();
+        }
+
+        lock.lock();
+        m_pending.erase(idx);
+        if (error.empty()) {
+            m_slices[idx] = std::move(slice);
+        } else {
+            m_error = error;
+        }
+        m_cv.notify_all();
+    }
+}
+
+BndryPlaneSlice ABLBoundaryPlaneReader::read_slice(const int idx) const
+{
+    if (m_chunked) {
+        return read_chunked_slice(idx);
+    }
+
+    const std::string chkname =
+        m_dirname + amrex::Concatenate("/bndry_output", m_timesteps[idx]);
+
+    BndryPlaneSlice slice;
+    slice.faces.resize(m_face_names.size());
+    for (int iface = 0; iface < m_face_names.size(); ++iface) {
+        read_face(chkname + "/" + m_face_names[iface], slice.faces[iface]);
+    }
+    return slice;
+}
+
+void ABLBoundaryPlaneReader::read_face(
+    const std::string& name, amrex::Vector<amrex::FArrayBox>& fabs)
+{
+    const std::string hdr_name = name + "_H";
+    std::ifstream hdr_file(hdr_name);
+    if (!hdr_file.good()) {
+        throw std::runtime_error(
+            "ABLBoundaryPlaneReader: cannot open file " + hdr_name);
+    }
+
+    amrex::VisMF::Header hdr;
+    hdr_file >> hdr;
+
+    // Data files are stored next to the header
+    const auto pos = name.find_last_of('/');
+    const std::string dir =
+        (pos == std::string::npos) ? "" : name.substr(0, pos + 1);
+
+    fabs.clear();
+    fabs.reserve(hdr.m_fod.size());
+    for (int i = 0; i < hdr.m_fod.size(); ++i) {
+        const auto& fod = hdr.m_fod[i];
+        const std::string data_name = dir + fod.m_name;
+        std::ifstream ifs(data_name, std::ios::in | std::ios::binary);
+        if (!ifs.good()) {
+            throw std::runtime_error(
+                "ABLBoundaryPlaneReader: cannot open file " + data_name);
+        }
+        ifs.seekg(fod.m_head, std::ios::beg);
+
+        fabs.emplace_back(amrex::The_Pinned_Arena());
+        auto& fab = fabs.back();
+        if (hdr.m_vers == amrex::VisMF::Header::Version_v1) {
+            fab.readFrom(ifs);
+        } else {
+            fab.resize(
+                amrex::grow(hdr.m_ba[i], hdr.m_ngrow), hdr.m_ncomp,
+                amrex::The_Pinned_Arena());
+            amrex::RealDescriptor::convertToNativeFormat(
+                fab.dataPtr(), fab.size(), ifs, hdr.m_writtenRD);
+        }
+        if (ifs.fail()) {
+            throw std::runtime_error(
+                "ABLBoundaryPlaneReader: error reading file " + data_name);
+        }
+    }
+}
+
+BndryPlaneSlice ABLBoundaryPlaneReader::read_chunked_slice(const int idx) const
+{
+    const int step = m_timesteps[idx];
+    const auto it = std::find_if(
+        m_chunks.begin(), m_chunks.end(), [step](const ChunkInfo& info) {
+            return (info.first_step <= step) && (step <= info.last_step);
+        });
+    if (it == m_chunks.end()) {
+        throw std::runtime_error(
+            "ABLBoundaryPlaneReader: no chunk contains step " +
+            std::to_string(step));
+    }
+    const int ichunk = static_cast<int>(std::distance(m_chunks.begin(), it));
+    if (ichunk != m_cached_chunk) {
+        read_chunk_index(ichunk);
+    }
+
+    const std::string chunk_dir =
+        m_dirname + amrex::Concatenate("/bndry_chunk", it->first_step);
+
+    BndryPlaneSlice slice;
+    slice.faces.resize(m_face_names.size());
+    const auto entries = m_chunk_index.find(step);
+    if (entries == m_chunk_index.end()) {
+        return slice;
+    }
+
+    std::map<int, std::ifstream> data_files;
+    for (const auto& entry : entries->second) {
+        auto& ifs = data_files[entry.rank];
+        if (!ifs.is_open()) {
+            const std::string data_name =
+                chunk_dir + amrex::Concatenate("/data_", entry.rank, 5);
+            ifs.open(data_name, std::ios::in | std::ios::binary);
+            if (!ifs.good()) {
+                throw std::runtime_error(
+                    "ABLBoundaryPlaneReader: cannot open file " + data_name);
+            }
+        }
+
+        auto& fabs = slice.faces[entry.face];
+        fabs.emplace_back(entry.box, entry.ncomp, amrex::The_Pinned_Arena());
+        auto& fab = fabs.back();
+        ifs.seekg(
+            static_cast<std::streamoff>(entry.offset * sizeof(amrex::Real)),
+            std::ios::beg);
+        ifs.read(
+            reinterpret_cast<char*>(fab.dataPtr()),
+            static_cast<std::streamsize>(fab.size() * sizeof(amrex::Real)));
+        if (ifs.fail()) {
+            throw std::runtime_error(
+                "ABLBoundaryPlaneReader: error reading data of step " +
+                std::to_string(step) + " from rank " +
+                std::to_string(entry.rank));
+        }
+    }
+    return slice;
+}
+
+void ABLBoundaryPlaneReader::read_chunk_index(const int ichunk) const
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlaneReader::read_chunk_index");
+    const auto& info = m_chunks[ichunk];
+    const std::string chunk_dir =
+        m_dirname + amrex::Concatenate("/bndry_chunk", info.first_step);
+
+    m_chunk_index.clear();
+    m_cached_chunk = -1;
+    for (int rank = 0; rank < info.nprocs; ++rank) {
+        const std::string index_name =
+            chunk_dir + amrex::Concatenate("/index_", rank, 5);
+        std::ifstream index_file(index_name);
+        if (!index_file.good()) {
+            throw std::runtime_error(
+                "ABLBoundaryPlaneReader: cannot open file " + index_name);
+        }
+
+        size_t real_size = 0;
+        index_file >> real_size;
+        if (real_size != sizeof(amrex::Real)) {
+            throw std::runtime_error(
+                "ABLBoundaryPlaneReader: precision mismatch in " + index_name);
+        }
+
+        int step = 0;
+        std::string face_name;
+        ChunkEntry entry{};
+        entry.rank = rank;
+        while (index_file >> step >> face_name >> entry.ncomp >> entry.box >>
+               entry.offset) {
+            const auto face = m_face_ids.find(face_name);
+            if (face == m_face_ids.end()) {
+                continue;
+            }
+            entry.face = face->second;
+            m_chunk_index[step].push_back(entry);
+        }
+    }
+    m_cached_chunk = ichunk;
+}
+
+} // namespace amr_wind
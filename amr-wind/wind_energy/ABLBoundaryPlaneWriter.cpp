@@ -0,0 +1,150 @@
+#include "amr-wind/wind_energy/ABLBoundaryPlaneWriter.H"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#include "AMReX_BLProfiler.H"
+#include "AMReX_GpuContainers.H"
+#include "AMReX_ParallelDescriptor.H"
+#include "AMReX_Utility.H"
+
+namespace amr_wind {
+
+ABLBoundaryPlaneWriter::ABLBoundaryPlaneWriter(
+    std::string dirname, const int steps_per_file)
+    : m_dirname(std::move(dirname)), m_steps_per_file(steps_per_file)
+{
+    AMREX_ALWAYS_ASSERT(m_steps_per_file > 0);
+}
+
+ABLBoundaryPlaneWriter::~ABLBoundaryPlaneWriter()
+{
+    flush();
+    wait();
+}
+
+void ABLBoundaryPlaneWriter::stage(
+    const int step, const std::string& face_name, const amrex::MultiFab& mf)
+{
+    BL_PROFILE("amr-wind::ABLBoundaryPlaneWriter::stage");
+    for (amrex::MFIter mfi(mf); mfi.isValid(); ++mfi) {
+        const auto& fab = mf[mfi];
+        const auto npts = static_cast<size_t>(fab.size());
+        const size_t offset = m_chunk.data.size();
+        m_chunk.data.resize(offset + npts);
+        amrex::Gpu::copyAsync(
+            amrex::Gpu::deviceToHost, fab.dataPtr(), fab.dataPtr() + npts,
+            m_chunk.data.data() + offset);
+        m_chunk.entries.push_back(
+            {step, face_name, fab.box(), fab.nComp(), offset});
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+void ABLBoundaryPlaneWriter::end_step(const int step, const int nlevels)
+{
+    if (m_chunk.nsteps == 0) {
+        m_chunk.first_step = step;
+        // Data staged per step does not change within a chunk
+        m_chunk.data.reserve(m_chunk.data.size() * m_steps_per_file);
+        m_chunk.entries.reserve(m_chunk.entries.size() * m_steps_per_file);
+    }
+    m_chunk.last_step = step;
+    m_chunk.nlevels = std::max(m_chunk.nlevels, nlevels);
+    ++m_chunk.nsteps;
+
+    if (m_chunk.nsteps >= m_steps_per_file) {
+        flush();
+    }
+}
+
+void ABLBoundaryPlaneWriter::flush()
+{
+    if (m_chunk.nsteps == 0) {
+        return;
+    }
+    BL_PROFILE("amr-wind::ABLBoundaryPlaneWriter::flush");
+
+    // Bound the number of chunks held in memory to two
+    wait();
+
+    const int rank = amrex::ParallelDescriptor::MyProc();
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const bool is_io = amrex::ParallelDescriptor::IOProcessor();
+    m_future = std::async(
+        std::launch::async,
+        [dirname = m_dirname, rank, nprocs, is_io,
+         chunk = std::move(m_chunk)]() {
+            write_chunk(dirname, rank, nprocs, is_io, chunk);
+        });
+    m_chunk = Chunk();
+}
+
+void ABLBoundaryPlaneWriter::wait()
+{
+    if (m_future.valid()) {
+        BL_PROFILE("amr-wind::ABLBoundaryPlaneWriter::wait");
+        try {
+            m_future.get();
+        } catch (const std::exception& err) {
+            amrex::Abort(err.what());
+        }
+    }
+}
+
+void ABLBoundaryPlaneWriter::write_chunk(
+    const std::string& dirname,
+    const int rank,
+    const int nprocs,
+    const bool is_io,
+    const Chunk& chunk)
+{
+    const std::string chunk_dir =
+        dirname + amrex::Concatenate("/bndry_chunk", chunk.first_step);
+    if (!amrex::UtilCreateDirectory(chunk_dir, 0755)) {
+        throw std::runtime_error(
+            "ABLBoundaryPlaneWriter: cannot create directory " + chunk_dir);
+    }
+
+    const std::string data_name =
+        chunk_dir + amrex::Concatenate("/data_", rank, 5);
+    std::ofstream data_file(data_name, std::ios::out | std::ios::binary);
+    if (!data_file.good()) {
+        throw std::runtime_error(
+            "ABLBoundaryPlaneWriter: cannot open file " + data_name);
+    }
+    data_file.write(
+        reinterpret_cast<const char*>(chunk.data.data()),
+        static_cast<std::streamsize>(chunk.data.size() * sizeof(amrex::Real)));
+    data_file.close();
+    if (data_file.fail()) {
+        throw std::runtime_error(
+            "ABLBoundaryPlaneWriter: error writing file " + data_name);
+    }
+
+    const std::string index_name =
+        chunk_dir + amrex::Concatenate("/index_", rank, 5);
+    std::ofstream index_file(index_name, std::ios::out);
+    if (!index_file.good()) {
+        throw std::runtime_error(
+            "ABLBoundaryPlaneWriter: cannot open file " + index_name);
+    }
+    index_file << sizeof(amrex::Real) << '\n';
+    for (const auto& entry : chunk.entries) {
+        index_file << entry.step << ' ' << entry.face_name << ' '
+                   << entry.ncomp << ' ' << entry.box << ' ' << entry.offset
+                   << '\n';
+    }
+    index_file.close();
+
+    if (is_io) {
+        std::ofstream chunks_file(
+            dirname + "/chunks.dat", std::ios::out | std::ios::app);
+        chunks_file << chunk.first_step << ' ' << chunk.last_step << ' '
+                    << nprocs << ' ' << chunk.nlevels << '\n';
+    }
+}
+
+} // namespace amr_wind
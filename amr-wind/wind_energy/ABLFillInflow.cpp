@@ -27,6 +27,19 @@ void ABLFillInflow::fillpatch(
     m_bndry_plane.populate_data(lev, time, m_field, mfab);
 }
 
+void ABLFillInflow::fillpatch_end(
+    int lev,
+    amrex::Real time,
+    amrex::MultiFab& mfab,
+    const amrex::IntVect& nghost,
+    const FieldState fstate)
+{
+    FieldFillPatchOps<FieldBCDirichlet>::fillpatch_end(
+        lev, time, mfab, nghost, fstate);
+
+    m_bndry_plane.populate_data(lev, time, m_field, mfab);
+}
+
 void ABLFillInflow::fillpatch_from_coarse(
     int lev,
     amrex::Real time,
@@ -31,6 +31,23 @@ void ABLFillMPL::fillpatch(
     }
 }
 
+void ABLFillMPL::fillpatch_end(
+    const int lev,
+    const amrex::Real time,
+    amrex::MultiFab& mfab,
+    const amrex::IntVect& nghost,
+    const FieldState fstate)
+{
+    FieldFillPatchOps<FieldBCDirichlet>::fillpatch_end(
+        lev, time, mfab, nghost, fstate);
+
+    if (m_field.base_name() == "velocity") {
+        m_abl_mpl.set_velocity(lev, time, m_field, mfab);
+    } else if (m_field.base_name() == "temperature") {
+        m_abl_mpl.set_temperature(lev, time, m_field, mfab);
+    }
+}
+
 void ABLFillMPL::fillpatch_from_coarse(
     const int lev,
     const amrex::Real time,
@@ -34,7 +34,15 @@ ABLStats::ABLStats(
     , m_pa_tu(m_pa_vel, m_pa_temp)
     , m_pa_uu(m_pa_vel, m_pa_vel)
     , m_pa_uuu(m_pa_vel, m_pa_vel, m_pa_vel)
-{}
+{
+    m_pa_batch.add(m_pa_vel);
+    m_pa_batch.add(m_pa_temp);
+    m_pa_batch.add(m_pa_mueff);
+    m_pa_batch.add(m_pa_tt);
+    m_pa_batch.add(m_pa_tu);
+    m_pa_batch.add(m_pa_uu);
+    m_pa_batch.add(m_pa_uuu);
+}
 
 ABLStats::~ABLStats() = default;
 
@@ -91,14 +99,12 @@ void ABLStats::initialize()
     }
 }
 
-void ABLStats::calc_averages()
+void ABLStats::calc_averages(const bool with_moments)
 {
     BL_PROFILE("amr-wind::ABLStats::calc_averages");
-    m_pa_vel();
-    m_pa_temp();
+    m_pa_batch(with_moments);
     m_pa_vel_fine();
     m_pa_temp_fine();
-    m_pa_mueff();
 }
 
 //! Calculate sfs stress averages
@@ -211,23 +217,21 @@ void ABLStats::post_advance_work()
 {
     BL_PROFILE("amr-wind::ABLStats::post_advance_work");
 
-    // Always compute mean velocity/temperature profiles
-    calc_averages();
-
     const auto& time = m_sim.time();
     const int tidx = time.time_index();
+    const bool output_step = (tidx % m_out_freq == 0);
+
+    // Always compute mean velocity/temperature profiles, the moments are
+    // only needed for output and are computed within the same pass
+    calc_averages(output_step);
+
     // Skip processing if it is not an output timestep
-    if (!(tidx % m_out_freq == 0)) {
+    if (!output_step) {
         return;
     }
 
     compute_zi();
 
-    m_pa_tt();
-    m_pa_tu();
-    m_pa_uu();
-    m_pa_uuu();
-
     process_output();
 }
 
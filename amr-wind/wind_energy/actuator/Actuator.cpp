@@ -5,9 +5,11 @@
 #include "amr-wind/core/FieldRepo.H"
 #include "amr-wind/utilities/io_utils.H"
 #include "amr-wind/utilities/IOManager.H"
+#include "amr-wind/utilities/PerfLog.H"
 
 #include <algorithm>
 #include <memory>
+#include <set>
 
 namespace amr_wind::actuator {
 
@@ -16,7 +18,11 @@ Actuator::Actuator(CFDSim& sim)
     , m_act_source(sim.repo().declare_field("actuator_src_term", 3, 1))
 {}
 
-Actuator::~Actuator() = default;
+Actuator::~Actuator()
+{
+    // External solvers may still reference actuator data in the background
+    sync_external_solvers();
+}
 
 void Actuator::pre_init_actions()
 {
@@ -30,6 +36,7 @@ void Actuator::pre_init_actions()
         "Duplicates in " + identifier() + ".labels");
 
     const int nturbines = static_cast<int>(labels.size());
+    pp.query("persistent_point_map", m_persistent_point_map);
 
     if (nturbines > 50) {
         amrex::Print()
@@ -145,7 +152,9 @@ void Actuator::post_regrid_actions()
 void Actuator::pre_advance_work()
 {
     BL_PROFILE("amr-wind::actuator::Actuator::pre_advance_work");
+    PerfLog::Timer timer(PerfLog::Actuator);
 
+    sync_external_solvers();
     m_container->reset_container();
     update_positions();
     update_velocities();
@@ -217,6 +226,19 @@ void Actuator::setup_container()
         }
     }
 
+    if (m_persistent_point_map) {
+        // The points can only lie within the boxes of the ranks influenced by
+        // the turbines sampled on this rank
+        std::set<int> procs;
+        for (const auto& act : m_actuators) {
+            const auto& info = act->info();
+            if (info.sample_vel_in_proc) {
+                procs.insert(info.procs.begin(), info.procs.end());
+            }
+        }
+        m_container->use_point_map(procs);
+    }
+
     m_container->initialize_container();
 }
 
@@ -269,6 +291,20 @@ void Actuator::update_velocities()
     }
 }
 
+/** Helper method to wait for external solvers advanced in the background
+ *
+ *  This is the synchronization point for turbines advanced asynchronously
+ *  (e.g., `openfast_async`), the results of the previous advance are
+ *  available once this method returns.
+ */
+void Actuator::sync_external_solvers()
+{
+    BL_PROFILE("amr-wind::actuator::Actuator::sync_external_solvers");
+    for (auto& ac : m_actuators) {
+        ac->sync_external_solver();
+    }
+}
+
 /** Helper method to compute forces on all actuator components
  */
 void Actuator::compute_forces()
@@ -330,6 +366,7 @@ void Actuator::prepare_outputs()
 void Actuator::post_advance_work()
 {
     BL_PROFILE("amr-wind::actuator::Actuator::post_advance_work");
+    PerfLog::Timer timer(PerfLog::Actuator);
 
     const int iproc = amrex::ParallelDescriptor::MyProc();
     for (auto& ac : m_actuators) {
@@ -42,8 +42,6 @@ void ActuatorContainer::initialize_container()
 {
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::initialize_container");
 
-    compute_local_coordinates();
-
     // Initialize global data arrays
     const int total_pts =
         std::accumulate(m_data.num_pts.begin(), m_data.num_pts.end(), 0);
@@ -51,6 +49,17 @@ void ActuatorContainer::initialize_container()
     m_data.velocity.resize(total_pts);
     m_data.density.resize(total_pts);
 
+    // The point map replaces the particles entirely
+    if (m_use_point_map) {
+        m_point_map =
+            std::make_unique<ActuatorPointMap>(m_mesh, m_map_procs, total_pts);
+        m_container_initialized = true;
+        m_is_scattered = false;
+        return;
+    }
+
+    compute_local_coordinates();
+
     {
         const int nproc = amrex::ParallelDescriptor::NProcs();
         amrex::Vector<int> pts_per_proc(nproc, 0);
@@ -126,6 +135,10 @@ void ActuatorContainer::initialize_particles(const int total_pts)
 
 void ActuatorContainer::reset_container()
 {
+    if (m_point_map) {
+        return;
+    }
+
     const int nlevels = m_mesh.finestLevel() + 1;
     for (int lev = 0; lev < nlevels; ++lev) {
         for (ParIterType pti(*this, lev); pti.isValid(); ++pti) {
@@ -162,6 +175,12 @@ void ActuatorContainer::update_positions()
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::update_positions");
     AMREX_ALWAYS_ASSERT(m_container_initialized && !m_is_scattered);
 
+    if (m_point_map) {
+        m_point_map->update_positions(m_data.position);
+        m_is_scattered = true;
+        return;
+    }
+
     const auto dpos = gpu::device_view(m_data.position);
     const auto* const dptr = dpos.data();
     const int nlevels = m_mesh.finestLevel() + 1;
@@ -204,6 +223,13 @@ void ActuatorContainer::sample_fields(const Field& vel, const Field& density)
     BL_PROFILE("amr-wind::actuator::ActuatorContainer::sample_velocities");
     AMREX_ALWAYS_ASSERT(m_container_initialized && m_is_scattered);
 
+    if (m_point_map) {
+        m_point_map->sample_fields(
+            vel, density, m_data.velocity, m_data.density);
+        m_is_scattered = false;
+        return;
+    }
+
     // Sample velocity field
     interpolate_fields(vel, density);
 
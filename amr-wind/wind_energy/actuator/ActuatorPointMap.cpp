@@ -0,0 +1,427 @@
+#include "amr-wind/wind_energy/actuator/ActuatorPointMap.H"
+#include "amr-wind/core/Field.H"
+
+#include "AMReX_ParallelDescriptor.H"
+
+#include <algorithm>
+#include <cmath>
+
+namespace amr_wind::actuator {
+
+namespace {
+#ifdef AMREX_USE_MPI
+MPI_Datatype real_type()
+{
+    return amrex::ParallelDescriptor::Mpi_typemap<amrex::Real>::type();
+}
+#endif
+} // namespace
+
+ActuatorPointMap::ActuatorPointMap(
+    const amrex::AmrCore& mesh,
+    const std::set<int>& procs,
+    const int num_points)
+    : m_mesh(mesh)
+    , m_lev(num_points, -1)
+    , m_box(num_points, -1)
+    , m_owner(num_points, -1)
+{
+    BL_PROFILE("amr-wind::actuator::ActuatorPointMap::ActuatorPointMap");
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+
+    // The points can only be owned by the ranks influenced by the turbines
+    if (num_points > 0) {
+        for (const int ip : procs) {
+            if (ip != iproc) {
+                m_dest_procs.push_back(ip);
+            }
+        }
+    }
+    const int ndest = static_cast<int>(m_dest_procs.size());
+    m_dest_points.resize(ndest);
+    m_send_pos.resize(ndest);
+    m_recv_val.resize(ndest);
+
+    // Let every rank know which ranks may send points to it and the maximum
+    // number of points in these messages
+    amrex::Vector<int> send_counts(nprocs, 0);
+    amrex::Vector<int> recv_counts(nprocs, 0);
+    for (const int ip : m_dest_procs) {
+        send_counts[ip] = num_points;
+    }
+#ifdef AMREX_USE_MPI
+    MPI_Alltoall(
+        send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT,
+        amrex::ParallelDescriptor::Communicator());
+#endif
+    for (int ip = 0; ip < nprocs; ++ip) {
+        if (recv_counts[ip] > 0) {
+            m_src_procs.push_back(ip);
+            m_src_max_points.push_back(recv_counts[ip]);
+        }
+    }
+    const int nsrc = static_cast<int>(m_src_procs.size());
+    m_recv_pos.resize(nsrc);
+    m_send_val.resize(nsrc);
+    for (int is = 0; is < nsrc; ++is) {
+        m_recv_pos[is].resize(
+            static_cast<size_t>(m_src_max_points[is]) * pos_size);
+    }
+
+    m_pos_tag = amrex::ParallelDescriptor::SeqNum();
+    m_val_tag = amrex::ParallelDescriptor::SeqNum();
+}
+
+ActuatorPointMap::~ActuatorPointMap()
+{
+#ifdef AMREX_USE_MPI
+    // Discard the exchange of a sampling that was never completed
+    for (auto* reqs : {&m_recv_pos_reqs, &m_recv_val_reqs}) {
+        for (auto& req : *reqs) {
+            if (req != MPI_REQUEST_NULL) {
+                MPI_Cancel(&req);
+                MPI_Request_free(&req);
+            }
+        }
+    }
+#endif
+    wait_sends();
+}
+
+amrex::IntVect
+ActuatorPointMap::cell_index(const vs::Vector& pos, const int lev) const
+{
+    const auto& geom = m_mesh.Geom(lev);
+    const auto& plo = geom.ProbLoArray();
+    const auto& dxinv = geom.InvCellSizeArray();
+    return amrex::IntVect(AMREX_D_DECL(
+        static_cast<int>(std::floor((pos[0] - plo[0]) * dxinv[0])),
+        static_cast<int>(std::floor((pos[1] - plo[1]) * dxinv[1])),
+        static_cast<int>(std::floor((pos[2] - plo[2]) * dxinv[2]))));
+}
+
+bool ActuatorPointMap::locate(const vs::Vector& pos, int& lev, int& box) const
+{
+    for (int ilev = m_mesh.finestLevel(); ilev >= 0; --ilev) {
+        const auto iv = cell_index(pos, ilev);
+        const auto isects =
+            m_mesh.boxArray(ilev).intersections(amrex::Box(iv, iv), true, 0);
+        if (!isects.empty()) {
+            lev = ilev;
+            box = isects[0].first;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ActuatorPointMap::in_cached_box(const vs::Vector& pos, const int ip) const
+{
+    const int lev = m_lev[ip];
+    if ((lev < 0) || (lev > m_mesh.finestLevel()) ||
+        !m_mesh.boxArray(lev)[m_box[ip]].contains(cell_index(pos, lev))) {
+        return false;
+    }
+
+    // The point must not have moved into a finer level
+    for (int ilev = lev + 1; ilev <= m_mesh.finestLevel(); ++ilev) {
+        const auto iv = cell_index(pos, ilev);
+        if (m_mesh.boxArray(ilev).intersects(amrex::Box(iv, iv))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ActuatorPointMap::pack_point(
+    amrex::Vector<amrex::Real>& buf, const int ip, const vs::Vector& pos) const
+{
+    buf.push_back(static_cast<amrex::Real>(m_lev[ip]));
+    buf.push_back(static_cast<amrex::Real>(m_box[ip]));
+    for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+        buf.push_back(pos[n]);
+    }
+}
+
+/** Update the map and start the exchange of the positions
+ *
+ *  Only the points that have left their box since the previous update are
+ *  searched in the box arrays. The receives for the positions from other ranks
+ *  and for the fields interpolated by other ranks are posted here, so that the
+ *  messages can progress until ActuatorPointMap::sample_fields is called.
+ */
+void ActuatorPointMap::update_positions(
+    const amrex::Vector<vs::Vector>& position)
+{
+    BL_PROFILE("amr-wind::actuator::ActuatorPointMap::update_positions");
+    AMREX_ALWAYS_ASSERT(!m_posted);
+    AMREX_ALWAYS_ASSERT(position.size() == m_owner.size());
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    const int npts = static_cast<int>(position.size());
+
+    m_num_relocated = 0;
+    for (int ip = 0; ip < npts; ++ip) {
+        if (in_cached_box(position[ip], ip)) {
+            continue;
+        }
+
+        ++m_num_relocated;
+        if (!locate(position[ip], m_lev[ip], m_box[ip])) {
+            amrex::Abort("ActuatorPointMap: actuator point outside the domain");
+        }
+        m_owner[ip] = m_mesh.DistributionMap(m_lev[ip])[m_box[ip]];
+    }
+
+    // The lists of points sent to each rank only change when points move
+    // across boxes
+    if (m_num_relocated > 0) {
+        m_local_points.clear();
+        for (auto& pts : m_dest_points) {
+            pts.clear();
+        }
+        for (int ip = 0; ip < npts; ++ip) {
+            if (m_owner[ip] == iproc) {
+                m_local_points.push_back(ip);
+                continue;
+            }
+            const auto it = std::lower_bound(
+                m_dest_procs.begin(), m_dest_procs.end(), m_owner[ip]);
+            if ((it == m_dest_procs.end()) || (*it != m_owner[ip])) {
+                amrex::Abort(
+                    "ActuatorPointMap: actuator point owned by a rank outside "
+                    "the region of influence of its turbine");
+            }
+            m_dest_points[std::distance(m_dest_procs.begin(), it)].push_back(
+                ip);
+        }
+    }
+
+    m_local_buf.clear();
+    for (const int ip : m_local_points) {
+        pack_point(m_local_buf, ip, position[ip]);
+    }
+
+#ifdef AMREX_USE_MPI
+    const auto comm = amrex::ParallelDescriptor::Communicator();
+    const int nsrc = static_cast<int>(m_src_procs.size());
+    const int ndest = static_cast<int>(m_dest_procs.size());
+
+    m_recv_pos_reqs.assign(nsrc, MPI_REQUEST_NULL);
+    for (int is = 0; is < nsrc; ++is) {
+        MPI_Irecv(
+            m_recv_pos[is].data(), static_cast<int>(m_recv_pos[is].size()),
+            real_type(), m_src_procs[is], m_pos_tag, comm,
+            &m_recv_pos_reqs[is]);
+    }
+
+    m_recv_val_reqs.assign(ndest, MPI_REQUEST_NULL);
+    for (int id = 0; id < ndest; ++id) {
+        auto& buf = m_recv_val[id];
+        buf.resize(m_dest_points[id].size() * val_size);
+        MPI_Irecv(
+            buf.data(), static_cast<int>(buf.size()), real_type(),
+            m_dest_procs[id], m_val_tag, comm, &m_recv_val_reqs[id]);
+    }
+
+    // Every neighbour receives a message, possibly empty
+    for (int id = 0; id < ndest; ++id) {
+        auto& buf = m_send_pos[id];
+        buf.clear();
+        for (const int ip : m_dest_points[id]) {
+            pack_point(buf, ip, position[ip]);
+        }
+        m_send_reqs.emplace_back();
+        MPI_Isend(
+            buf.data(), static_cast<int>(buf.size()), real_type(),
+            m_dest_procs[id], m_pos_tag, comm, &m_send_reqs.back());
+    }
+#endif
+
+    m_posted = true;
+}
+
+/** Interpolate the fields at the points and complete the exchange
+ *
+ *  The points within the boxes of this rank are interpolated first, while the
+ *  positions sent by the other ranks are in flight. The points received from
+ *  each rank are then interpolated and sent back as soon as they arrive.
+ */
+void ActuatorPointMap::sample_fields(
+    const Field& vel,
+    const Field& density,
+    amrex::Vector<vs::Vector>& velocity,
+    amrex::Vector<amrex::Real>& rho)
+{
+    BL_PROFILE("amr-wind::actuator::ActuatorPointMap::sample_fields");
+    AMREX_ALWAYS_ASSERT(m_posted);
+
+    const auto unpack = [&](const amrex::Vector<int>& points,
+                            const amrex::Vector<amrex::Real>& values) {
+        for (int n = 0; n < static_cast<int>(points.size()); ++n) {
+            const int ip = points[n];
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                velocity[ip][d] = values[n * val_size + d];
+            }
+            rho[ip] = values[n * val_size + AMREX_SPACEDIM];
+        }
+    };
+
+    {
+        amrex::Vector<amrex::Real> values;
+        interpolate(
+            vel, density, m_local_buf.data(),
+            static_cast<int>(m_local_points.size()), values);
+        unpack(m_local_points, values);
+    }
+
+#ifdef AMREX_USE_MPI
+    const auto comm = amrex::ParallelDescriptor::Communicator();
+    const int nsrc = static_cast<int>(m_src_procs.size());
+    for (int n = 0; n < nsrc; ++n) {
+        int is = 0;
+        MPI_Status status;
+        MPI_Waitany(nsrc, m_recv_pos_reqs.data(), &is, &status);
+        int count = 0;
+        MPI_Get_count(&status, real_type(), &count);
+
+        auto& buf = m_send_val[is];
+        interpolate(vel, density, m_recv_pos[is].data(), count / pos_size, buf);
+        m_send_reqs.emplace_back();
+        MPI_Isend(
+            buf.data(), static_cast<int>(buf.size()), real_type(),
+            m_src_procs[is], m_val_tag, comm, &m_send_reqs.back());
+    }
+
+    MPI_Waitall(
+        static_cast<int>(m_recv_val_reqs.size()), m_recv_val_reqs.data(),
+        MPI_STATUSES_IGNORE);
+    for (int id = 0; id < static_cast<int>(m_dest_procs.size()); ++id) {
+        unpack(m_dest_points[id], m_recv_val[id]);
+    }
+#endif
+
+    wait_sends();
+    m_posted = false;
+}
+
+void ActuatorPointMap::wait_sends()
+{
+#ifdef AMREX_USE_MPI
+    MPI_Waitall(
+        static_cast<int>(m_send_reqs.size()), m_send_reqs.data(),
+        MPI_STATUSES_IGNORE);
+    m_send_reqs.clear();
+#endif
+}
+
+void ActuatorPointMap::interpolate(
+    const Field& vel,
+    const Field& density,
+    const amrex::Real* points,
+    const int npts,
+    amrex::Vector<amrex::Real>& values) const
+{
+    values.assign(static_cast<size_t>(npts) * val_size, 0.0);
+    if (npts == 0) {
+        return;
+    }
+
+    // Unpack the points, using the local indices of the boxes
+    amrex::Vector<int> lev_h(npts);
+    amrex::Vector<int> box_h(npts);
+    amrex::Vector<vs::Vector> pos_h(npts);
+    for (int ip = 0; ip < npts; ++ip) {
+        const auto* pp = &points[ip * pos_size];
+        lev_h[ip] = static_cast<int>(pp[0]);
+        box_h[ip] = vel(lev_h[ip]).localindex(static_cast<int>(pp[1]));
+        AMREX_ALWAYS_ASSERT(box_h[ip] >= 0);
+        for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+            pos_h[ip][n] = pp[2 + n];
+        }
+    }
+
+    amrex::Gpu::DeviceVector<int> lev_d(npts);
+    amrex::Gpu::DeviceVector<int> box_d(npts);
+    amrex::Gpu::DeviceVector<vs::Vector> pos_d(npts);
+    amrex::Gpu::DeviceVector<amrex::Real> val_d(values.size());
+    amrex::Gpu::copyAsync(
+        amrex::Gpu::hostToDevice, lev_h.begin(), lev_h.end(), lev_d.begin());
+    amrex::Gpu::copyAsync(
+        amrex::Gpu::hostToDevice, box_h.begin(), box_h.end(), box_d.begin());
+    amrex::Gpu::copyAsync(
+        amrex::Gpu::hostToDevice, pos_h.begin(), pos_h.end(), pos_d.begin());
+
+    const auto* plev = lev_d.data();
+    const auto* pbox = box_d.data();
+    const auto* ppos = pos_d.data();
+    auto* pval = val_d.data();
+    const int nlevels = m_mesh.finestLevel() + 1;
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& geom = m_mesh.Geom(lev);
+        const auto dx = geom.CellSizeArray();
+        const auto dxi = geom.InvCellSizeArray();
+        const auto plo = geom.ProbLoArray();
+        const auto varrs = vel(lev).const_arrays();
+        const auto darrs = density(lev).const_arrays();
+
+        amrex::ParallelFor(npts, [=] AMREX_GPU_DEVICE(const int ip) noexcept {
+            if (plev[ip] != lev) {
+                return;
+            }
+            const auto& varr = varrs[pbox[ip]];
+            const auto& darr = darrs[pbox[ip]];
+            const auto& pos = ppos[ip];
+
+            // Determine offsets within the containing cell
+            const amrex::Real x = (pos[0] - plo[0] - 0.5 * dx[0]) * dxi[0];
+            const amrex::Real y = (pos[1] - plo[1] - 0.5 * dx[1]) * dxi[1];
+            const amrex::Real z = (pos[2] - plo[2] - 0.5 * dx[2]) * dxi[2];
+
+            // Index of the low corner
+            const int i = static_cast<int>(std::floor(x));
+            const int j = static_cast<int>(std::floor(y));
+            const int k = static_cast<int>(std::floor(z));
+
+            // Interpolation weights in each direction (linear basis)
+            const amrex::Real wx_hi = (x - i);
+            const amrex::Real wy_hi = (y - j);
+            const amrex::Real wz_hi = (z - k);
+
+            const amrex::Real wx_lo = 1.0 - wx_hi;
+            const amrex::Real wy_lo = 1.0 - wy_hi;
+            const amrex::Real wz_lo = 1.0 - wz_hi;
+
+            auto* out = &pval[ip * val_size];
+
+            // velocity
+            for (int ic = 0; ic < AMREX_SPACEDIM; ++ic) {
+                out[ic] =
+                    wx_lo * wy_lo * wz_lo * varr(i, j, k, ic) +
+                    wx_lo * wy_lo * wz_hi * varr(i, j, k + 1, ic) +
+                    wx_lo * wy_hi * wz_lo * varr(i, j + 1, k, ic) +
+                    wx_lo * wy_hi * wz_hi * varr(i, j + 1, k + 1, ic) +
+                    wx_hi * wy_lo * wz_lo * varr(i + 1, j, k, ic) +
+                    wx_hi * wy_lo * wz_hi * varr(i + 1, j, k + 1, ic) +
+                    wx_hi * wy_hi * wz_lo * varr(i + 1, j + 1, k, ic) +
+                    wx_hi * wy_hi * wz_hi * varr(i + 1, j + 1, k + 1, ic);
+            }
+
+            // density
+            out[AMREX_SPACEDIM] =
+                wx_lo * wy_lo * wz_lo * darr(i, j, k) +
+                wx_lo * wy_lo * wz_hi * darr(i, j, k + 1) +
+                wx_lo * wy_hi * wz_lo * darr(i, j + 1, k) +
+                wx_lo * wy_hi * wz_hi * darr(i, j + 1, k + 1) +
+                wx_hi * wy_lo * wz_lo * darr(i + 1, j, k) +
+                wx_hi * wy_lo * wz_hi * darr(i + 1, j, k + 1) +
+                wx_hi * wy_hi * wz_lo * darr(i + 1, j + 1, k) +
+                wx_hi * wy_hi * wz_hi * darr(i + 1, j + 1, k + 1);
+        });
+    }
+
+    amrex::Gpu::copy(
+        amrex::Gpu::deviceToHost, val_d.begin(), val_d.end(), values.begin());
+}
+
+} // namespace amr_wind::actuator
@@ -0,0 +1,108 @@
+#include "amr-wind/wind_energy/actuator/spreading_bins.H"
+#include "AMReX_BLProfiler.H"
+#include "AMReX_ParmParse.H"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace amr_wind::actuator::utils {
+
+namespace {
+//! Maximum number of bins in each direction
+constexpr int max_bins_per_dir = 64;
+} // namespace
+
+GaussianCutoff read_gaussian_cutoff()
+{
+    GaussianCutoff cutoff;
+    amrex::ParmParse pp("Actuator");
+    amrex::Real tol = 0.0;
+    if (pp.query("spreading_tolerance", tol) != 0) {
+        AMREX_ALWAYS_ASSERT((tol > 0.0) && (tol < 1.0));
+        cutoff.sqr_3d = -std::log(tol);
+        cutoff.sqr_1d = -std::log(tol);
+    }
+    return cutoff;
+}
+
+void SpreadingBins::build(const VecList& pos, const amrex::Real radius)
+{
+    BL_PROFILE("amr-wind::actuator::SpreadingBins::build");
+    const int npts = static_cast<int>(pos.size());
+
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> lo;
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> hi;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        lo[d] = std::numeric_limits<amrex::Real>::max();
+        hi[d] = std::numeric_limits<amrex::Real>::lowest();
+    }
+    for (const auto& p : pos) {
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            lo[d] = std::min(lo[d], p[d]);
+            hi[d] = std::max(hi[d], p[d]);
+        }
+    }
+
+    // A single bin of infinite width holds every point when there is no
+    // cutoff
+    m_view.nbins = {{1, 1, 1}};
+    m_view.inv_width = 0.0;
+    m_view.lo = {{0.0}};
+    if ((radius > 0.0) && (npts > 0)) {
+        amrex::Real width = radius;
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            width = std::max(width, (hi[d] - lo[d]) / max_bins_per_dir);
+        }
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            m_view.nbins[d] =
+                static_cast<int>(std::floor((hi[d] - lo[d]) / width)) + 1;
+        }
+        m_view.inv_width = 1.0 / width;
+        m_view.lo = lo;
+    }
+
+    // Counting sort of the points by bin, preserving their order in each bin
+    const int nbins = m_view.nbins[0] * m_view.nbins[1] * m_view.nbins[2];
+    amrex::Vector<int> bin_ids(npts);
+    amrex::Vector<int> offsets(nbins + 1, 0);
+    for (int ip = 0; ip < npts; ++ip) {
+        int ib[AMREX_SPACEDIM];
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            ib[d] = std::min(
+                static_cast<int>((pos[ip][d] - m_view.lo[d]) *
+                                 m_view.inv_width),
+                m_view.nbins[d] - 1);
+        }
+        bin_ids[ip] =
+            ib[0] + m_view.nbins[0] * (ib[1] + m_view.nbins[1] * ib[2]);
+        ++offsets[bin_ids[ip] + 1];
+    }
+    for (int ib = 0; ib < nbins; ++ib) {
+        offsets[ib + 1] += offsets[ib];
+    }
+    amrex::Vector<int> points(npts);
+    amrex::Vector<int> fill(offsets.begin(), offsets.end() - 1);
+    for (int ip = 0; ip < npts; ++ip) {
+        points[fill[bin_ids[ip]]++] = ip;
+    }
+
+    m_offsets.resize(offsets.size());
+    m_points.resize(points.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, offsets.begin(), offsets.end(),
+        m_offsets.begin());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, points.begin(), points.end(),
+        m_points.begin());
+}
+
+SpreadingBinsView SpreadingBins::view() const
+{
+    SpreadingBinsView view = m_view;
+    view.offsets = m_offsets.data();
+    view.points = m_points.data();
+    return view;
+}
+
+} // namespace amr_wind::actuator::utils
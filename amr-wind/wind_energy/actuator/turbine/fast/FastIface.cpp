@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <exception>
 
 namespace exw_fast {
 namespace {
@@ -45,6 +46,12 @@ FastIface::FastIface(const amr_wind::CFDSim& /*unused*/) {}
 
 FastIface::~FastIface()
 {
+    for (auto& item : m_pending) {
+        if (item.second.valid()) {
+            item.second.wait();
+        }
+    }
+
     int ierr = ErrID_None;
     amrex::Array<char, fast_strlen()> err_msg;
     FAST_DeallocateTurbines(&ierr, err_msg.begin());
@@ -151,6 +158,24 @@ void FastIface::advance_turbine(const int local_id)
     AMREX_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
 
     auto& fi = *m_turbine_data[local_id];
+    prepare_step(fi);
+    step_turbine(fi);
+}
+
+void FastIface::advance_turbine_async(const int local_id)
+{
+    BL_PROFILE("amr-wind::FastIface::advance_turbine_async");
+    AMREX_ASSERT(local_id < static_cast<int>(m_turbine_data.size()));
+    AMREX_ASSERT(!m_pending[local_id].valid());
+
+    auto& fi = *m_turbine_data[local_id];
+    prepare_step(fi);
+    m_pending[local_id] =
+        std::async(std::launch::async, [&fi]() { step_turbine(fi); });
+}
+
+void FastIface::prepare_step(FastTurbine& fi)
+{
     AMREX_ASSERT(!fi.is_solution0);
     {
         const auto& tmax = fi.stop_time;
@@ -166,7 +191,28 @@ void FastIface::advance_turbine(const int local_id)
         }
     }
 
+    // NetCDF output is not thread safe and is always performed here
     write_velocity_data(fi);
+}
+
+bool FastIface::sync_turbine(const int local_id)
+{
+    auto it = m_pending.find(local_id);
+    if ((it == m_pending.end()) || !it->second.valid()) {
+        return false;
+    }
+
+    BL_PROFILE("amr-wind::FastIface::sync_turbine");
+    try {
+        it->second.get();
+    } catch (const std::exception& err) {
+        amrex::Abort(err.what());
+    }
+    return true;
+}
+
+void FastIface::step_turbine(FastTurbine& fi)
+{
     for (int i = 0; i < fi.num_substeps; ++i, ++fi.time_index) {
         fast_func(FAST_Step, &fi.tid_local);
     }
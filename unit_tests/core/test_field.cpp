@@ -312,6 +312,51 @@ TEST_F(FieldRepoTest, scratch_fields)
     }
 }
 
+TEST_F(FieldRepoTest, scratch_field_pool)
+{
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    frepo.enable_scratch_pool(true);
+    const auto* pool = frepo.scratch_pool();
+    ASSERT_NE(pool, nullptr);
+
+    const amrex::Real* ptr = nullptr;
+    {
+        auto sfield = frepo.create_scratch_field(3, 1);
+        ptr = (*sfield)(0)[0].dataPtr();
+        EXPECT_EQ(pool->stats().num_allocs, 1);
+        EXPECT_EQ(pool->stats().num_live, 1);
+    }
+    EXPECT_EQ(pool->stats().num_live, 0);
+
+    {
+        // Same parameters reuse the pooled data
+        auto sfield = frepo.create_scratch_field(3, 1);
+        EXPECT_EQ((*sfield)(0)[0].dataPtr(), ptr);
+        EXPECT_EQ((*sfield)(0).nGrowVect(), amrex::IntVect(1));
+
+        // Different parameters require a new allocation
+        auto other = frepo.create_scratch_field(1, 1);
+        EXPECT_EQ(pool->stats().num_allocs, 2);
+        EXPECT_EQ(pool->stats().num_reuses, 1);
+        EXPECT_EQ(pool->stats().max_live, 2);
+    }
+
+    // Changing the mesh invalidates the pooled data
+    const auto& ba = frepo.mesh().boxArray(0);
+    const auto& dm = frepo.mesh().DistributionMap(0);
+    frepo.remake_level(0, 0.0, ba, dm);
+    {
+        auto sfield = frepo.create_scratch_field(3, 1);
+        EXPECT_EQ(pool->stats().num_allocs, 3);
+        EXPECT_EQ(pool->stats().num_reuses, 1);
+    }
+
+    frepo.enable_scratch_pool(false);
+    EXPECT_EQ(frepo.scratch_pool(), nullptr);
+}
+
 TEST_F(FieldRepoTest, int_scratch_fields)
 {
 
@@ -1,7 +1,13 @@
+#include <memory>
+#include <sstream>
+
 #include "aw_test_utils/MeshTest.H"
 #include "amr-wind/core/FieldBCOps.H"
 #include "amr-wind/core/FieldFillPatchOps.H"
+#include "amr-wind/core/FieldGroup.H"
 #include "amr-wind/projection/nodal_projection_ops.H"
+#include "amr-wind/utilities/tagging/CartBoxRefinement.H"
+#include "amr-wind/wind_energy/ABLFillInflow.H"
 
 namespace amr_wind_tests {
 
@@ -158,6 +164,28 @@ amrex::Real get_field_err(
     amrex::ParallelDescriptor::ReduceRealSum(error_total);
     return error_total;
 }
+
+void init_field_linear(amr_wind::Field& field, const amrex::AmrCore& mesh)
+{
+    const int ncomp = field.num_comp();
+    const int nlevels = field.repo().num_active_levels();
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& problo = mesh.Geom(lev).ProbLoArray();
+        const auto& dx = mesh.Geom(lev).CellSizeArray();
+        // Invalid values in the ghost cells that are to be filled
+        field(lev).setVal(-99.0);
+        const auto& farrs = field(lev).arrays();
+        amrex::ParallelFor(
+            field(lev), amrex::IntVect(0), ncomp,
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k, int n) noexcept {
+                const amrex::Real x = problo[0] + (i + 0.5) * dx[0];
+                const amrex::Real y = problo[1] + (j + 0.5) * dx[1];
+                const amrex::Real z = problo[2] + (k + 0.5) * dx[2];
+                farrs[nbx](i, j, k, n) = x + 2.0 * y + 3.0 * z + n;
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
 } // namespace
 
 class FieldFillPatchTest : public MeshTest
@@ -232,6 +260,20 @@ TEST_F(FieldFillPatchTest, dirichlet_fp)
     EXPECT_DOUBLE_EQ(err, 0.);
 }
 
+TEST_F(FieldFillPatchTest, dirichlet_group_fp)
+{
+    prep_test();
+
+    // Test split group fillpatch and check ghost cells
+    amr_wind::FieldGroup group;
+    group.add(*m_vel);
+    EXPECT_EQ(group.size(), 1);
+    group.fillpatch_begin(sim().time().current_time());
+    group.fillpatch_end();
+    const auto err = get_field_err(*m_vel, true);
+    EXPECT_DOUBLE_EQ(err, 0.);
+}
+
 TEST_F(FieldFillPatchTest, dirichlet_inflow)
 {
     prep_test();
@@ -277,4 +319,139 @@ TEST_F(FieldFillPatchTest, dirichlet_sibling_inflow)
     EXPECT_DOUBLE_EQ(err, 0.);
 }
 
+class FieldGroupFillPatchTest : public MeshTest
+{
+public:
+    void populate_parameters() override
+    {
+        // Default dimensions are n_cell = 8 x 8 x 8
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("amr");
+            pp.add("max_level", 1);
+            pp.add("max_grid_size", 4);
+            pp.add("blocking_factor", 2);
+        }
+        {
+            amrex::Vector<int> periodic{{0, 0, 0}};
+            amrex::ParmParse pp("geometry");
+            pp.addarr("is_periodic", periodic);
+        }
+    }
+
+    void set_up_mesh()
+    {
+        populate_parameters();
+
+        // Refine the half of the domain along the x-low boundary
+        std::stringstream ss;
+        ss << "1 // Number of levels" << std::endl;
+        ss << "1 // Number of boxes at this level" << std::endl;
+        ss << "0 0 0 4 8 8" << std::endl;
+
+        create_mesh_instance<RefineMesh>();
+        std::unique_ptr<amr_wind::CartBoxRefinement> box_refine(
+            new amr_wind::CartBoxRefinement(sim()));
+        box_refine->read_inputs(mesh(), ss);
+        if (mesh<RefineMesh>() != nullptr) {
+            mesh<RefineMesh>()->refine_criteria_vec().push_back(
+                std::move(box_refine));
+        }
+        initialize_mesh();
+        ASSERT_EQ(mesh().num_levels(), 2);
+    }
+
+    static void set_up_inflow_bcs(amr_wind::Field& field)
+    {
+        auto& ibctype = field.bc_type();
+        auto& fbcrec = field.bcrec();
+        for (amrex::OrientationIter oit; oit != nullptr; ++oit) {
+            auto ori = oit();
+            ibctype[ori] = BC::mass_inflow;
+            for (int i = 0; i < field.num_comp(); ++i) {
+                field.bc_values()[ori][i] = 10.0 * (ori + 1) + i;
+            }
+        }
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            for (int i = 0; i < field.num_comp(); ++i) {
+                fbcrec[i].setLo(dir, amrex::BCType::ext_dir);
+                fbcrec[i].setHi(dir, amrex::BCType::ext_dir);
+            }
+        }
+    }
+
+    void set_up_fields()
+    {
+        auto& frepo = mesh().field_repo();
+        m_vel = &frepo.declare_field("velocity", 3, 2, 1);
+        m_temp = &frepo.declare_field("temperature", 1, 2, 1);
+
+        set_up_inflow_bcs(*m_vel);
+        using InflowOp =
+            amr_wind::BCOpCreator<TestProfile, amr_wind::ConstDirichlet>;
+        (*m_vel).register_fill_patch_op<amr_wind::FieldFillPatchOps<InflowOp>>(
+            mesh(), time(), InflowOp(*m_vel));
+        (*m_vel).copy_bc_to_device();
+
+        // Without boundary plane data, the inflow takes the Dirichlet values
+        set_up_inflow_bcs(*m_temp);
+        m_bndry_plane = std::make_unique<amr_wind::ABLBoundaryPlane>(sim());
+        (*m_temp).register_fill_patch_op<amr_wind::ABLFillInflow>(
+            mesh(), time(), *m_bndry_plane);
+        (*m_temp).copy_bc_to_device();
+    }
+
+    amr_wind::Field* m_vel;
+    amr_wind::Field* m_temp;
+    std::unique_ptr<amr_wind::ABLBoundaryPlane> m_bndry_plane;
+};
+
+TEST_F(FieldGroupFillPatchTest, multilevel_matches_fillpatch)
+{
+    set_up_mesh();
+    set_up_fields();
+
+    amrex::Vector<amr_wind::Field*> fields{m_vel, m_temp};
+    const int nlevels = mesh().num_levels();
+
+    // Reference from the field by field fillpatch
+    amrex::Vector<amrex::Vector<amrex::MultiFab>> ref(fields.size());
+    for (int ifld = 0; ifld < static_cast<int>(fields.size()); ++ifld) {
+        auto& fld = *fields[ifld];
+        init_field_linear(fld, mesh());
+        fld.fillpatch(time().current_time());
+        for (int lev = 0; lev < nlevels; ++lev) {
+            ref[ifld].emplace_back(
+                fld(lev).boxArray(), fld(lev).DistributionMap(),
+                fld.num_comp(), fld.num_grow());
+            amrex::MultiFab::Copy(
+                ref[ifld][lev], fld(lev), 0, 0, fld.num_comp(),
+                fld.num_grow());
+        }
+    }
+
+    // Split group fillpatch of both fields
+    amr_wind::FieldGroup group;
+    for (auto* fld : fields) {
+        init_field_linear(*fld, mesh());
+        group.add(*fld);
+    }
+    EXPECT_EQ(group.size(), 2);
+    group.fillpatch_begin(time().current_time());
+    group.fillpatch_end();
+
+    for (int ifld = 0; ifld < static_cast<int>(fields.size()); ++ifld) {
+        auto& fld = *fields[ifld];
+        for (int lev = 0; lev < nlevels; ++lev) {
+            auto& diff = ref[ifld][lev];
+            amrex::MultiFab::Subtract(
+                diff, fld(lev), 0, 0, fld.num_comp(), fld.num_grow());
+            for (int n = 0; n < fld.num_comp(); ++n) {
+                EXPECT_EQ(diff.norm0(n, fld.num_grow()[0]), 0.0)
+                    << fld.name() << " level " << lev << " component " << n;
+            }
+        }
+    }
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,55 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/equation_systems/AdvectionWorkspace.H"
+
+namespace amr_wind_tests {
+
+class AdvectionWorkspaceTest : public MeshTest
+{};
+
+TEST_F(AdvectionWorkspaceTest, persistent_fields)
+{
+    populate_parameters();
+    initialize_mesh();
+    auto& repo = sim().repo();
+
+    amr_wind::pde::AdvectionWorkspace ws(repo, 2, 1, true);
+    auto& flux = ws.field(0, 3, 0, amr_wind::FieldLoc::XFACE);
+    auto& state = ws.field(1, 3, 2);
+    EXPECT_EQ(flux.field_location(), amr_wind::FieldLoc::XFACE);
+    EXPECT_EQ(state.num_grow(), amrex::IntVect(2));
+
+    // The fields are kept between calls
+    ws.release();
+    auto& flux2 = ws.field(0, 3, 0, amr_wind::FieldLoc::XFACE);
+    EXPECT_EQ(&flux2, &flux);
+
+    // A field with different parameters is reallocated
+    auto& state2 = ws.field(1, 1, 2);
+    EXPECT_EQ(state2.num_comp(), 1);
+
+    // Tile temporaries cover the requested box
+    const amrex::Box bx(amrex::IntVect(0), amrex::IntVect(3));
+    auto fab = ws.tile_fab(0, bx, 2);
+    EXPECT_EQ(fab.box(), bx);
+    EXPECT_EQ(fab.nComp(), 2);
+}
+
+TEST_F(AdvectionWorkspaceTest, transient_fields)
+{
+    populate_parameters();
+    initialize_mesh();
+    auto& repo = sim().repo();
+
+    amr_wind::pde::AdvectionWorkspace ws(repo, 1, 1, false);
+    EXPECT_FALSE(ws.persistent());
+    auto& fld = ws.field(0, 1, 1);
+    fld(0).setVal(1.0);
+    EXPECT_EQ(fld.num_comp(), 1);
+    ws.release();
+
+    auto& fld2 = ws.field(0, 2, 1);
+    EXPECT_EQ(fld2.num_comp(), 2);
+    ws.release();
+}
+
+} // namespace amr_wind_tests
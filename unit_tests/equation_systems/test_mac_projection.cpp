@@ -0,0 +1,153 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/test_utils.H"
+#include "amr-wind/core/field_ops.H"
+#include "amr-wind/equation_systems/icns/icns_advection.H"
+#include "amr-wind/utilities/tagging/CartBoxRefinement.H"
+
+namespace amr_wind_tests {
+
+#ifdef AMR_WIND_USE_FFT
+
+namespace {
+
+void init_mac_velocity(amr_wind::Field& mac_vel, const int dir)
+{
+    const auto& mesh = mac_vel.repo().mesh();
+    const int nlevels = mac_vel.repo().num_active_levels();
+    const amrex::Real twopi = 2.0 * M_PI;
+
+    for (int lev = 0; lev < nlevels; ++lev) {
+        const auto& dx = mesh.Geom(lev).CellSizeArray();
+        const auto& problo = mesh.Geom(lev).ProbLoArray();
+        const auto& farrs = mac_vel(lev).arrays();
+
+        amrex::ParallelFor(
+            mac_vel(lev),
+            [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+                const amrex::Real x =
+                    problo[0] + (i + ((dir == 0) ? 0.0 : 0.5)) * dx[0];
+                const amrex::Real y =
+                    problo[1] + (j + ((dir == 1) ? 0.0 : 0.5)) * dx[1];
+                const amrex::Real z =
+                    problo[2] + (k + ((dir == 2) ? 0.0 : 0.5)) * dx[2];
+                const amrex::Real xyz[3] = {x, y, z};
+                farrs[nbx](i, j, k) =
+                    std::sin(twopi * xyz[dir]) *
+                    std::cos(twopi * xyz[(dir + 1) % 3]);
+            });
+    }
+    amrex::Gpu::streamSynchronize();
+}
+
+} // namespace
+
+class MacProjectionTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("geometry");
+            amrex::Vector<amrex::Real> problo{{0.0, 0.0, 0.0}};
+            amrex::Vector<amrex::Real> probhi{{1.0, 1.0, 1.0}};
+            amrex::Vector<int> periodic{{1, 1, 1}};
+
+            pp.addarr("prob_lo", problo);
+            pp.addarr("prob_hi", probhi);
+            pp.addarr("is_periodic", periodic);
+        }
+        {
+            amrex::ParmParse pp("amr");
+            amrex::Vector<int> ncell{{16, 16, 16}};
+            pp.add("max_level", 1);
+            pp.add("max_grid_size", 8);
+            pp.add("blocking_factor", 4);
+            pp.addarr("n_cell", ncell);
+        }
+        {
+            amrex::ParmParse pp("incflo");
+            pp.add("density", m_rho_0);
+        }
+
+        std::stringstream ss;
+        ss << "1 // Number of levels" << std::endl;
+        ss << "1 // Number of boxes at this level" << std::endl;
+        ss << "0.25 0.25 0.25 0.75 0.75 0.75" << std::endl;
+
+        create_mesh_instance<RefineMesh>();
+        std::unique_ptr<amr_wind::CartBoxRefinement> box_refine(
+            new amr_wind::CartBoxRefinement(sim()));
+        box_refine->read_inputs(mesh(), ss);
+
+        if (mesh<RefineMesh>() != nullptr) {
+            mesh<RefineMesh>()->refine_criteria_vec().push_back(
+                std::move(box_refine));
+        }
+    }
+
+    //! Project the MAC velocity and return the number of MLMG iterations
+    int project(const bool fft_guess)
+    {
+        auto& repo = sim().repo();
+        const amrex::Vector<std::string> names{"u_mac", "v_mac", "w_mac"};
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            init_mac_velocity(repo.get_field(names[dir]), dir);
+        }
+
+        {
+            amrex::ParmParse pp("mac_proj");
+            pp.add("use_fft_coarse_guess", static_cast<int>(fft_guess));
+        }
+        amr_wind::pde::MacProjOp mac_proj(
+            repo, sim().physics_manager(), false, false, false, false);
+        mac_proj(amr_wind::FieldState::New, m_dt);
+        return mac_proj.num_mlmg_iters();
+    }
+
+    const amrex::Real m_rho_0 = 2.0;
+    const amrex::Real m_dt = 0.1;
+};
+
+TEST_F(MacProjectionTest, fft_coarse_guess)
+{
+    populate_parameters();
+    initialize_mesh();
+    ASSERT_EQ(mesh().finestLevel(), 1);
+
+    auto& pde_mgr = sim().pde_manager();
+    pde_mgr.register_icns();
+    sim().create_turbulence_model();
+    sim().init_physics();
+
+    auto& repo = sim().repo();
+    repo.get_field("density").setVal(m_rho_0);
+
+    const int num_iters = project(false);
+    const amrex::Vector<std::string> names{"u_mac", "v_mac", "w_mac"};
+    const amrex::Vector<amr_wind::FieldLoc> locs{
+        amr_wind::FieldLoc::XFACE, amr_wind::FieldLoc::YFACE,
+        amr_wind::FieldLoc::ZFACE};
+    amrex::Vector<std::unique_ptr<amr_wind::ScratchField>> ref;
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        ref.push_back(repo.create_scratch_field(1, 0, locs[dir]));
+        amr_wind::field_ops::copy(
+            *ref[dir], repo.get_field(names[dir]), 0, 0, 1, 0);
+    }
+
+    const int num_iters_fft = project(true);
+    EXPECT_LT(num_iters_fft, num_iters);
+
+    for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+        amr_wind::field_ops::saxpy(
+            *ref[dir], -1.0, repo.get_field(names[dir]), 0, 0, 1, 0);
+        const auto max_err = amrex::max(
+            utils::field_max(*ref[dir]), -utils::field_min(*ref[dir]));
+        EXPECT_NEAR(max_err, 0.0, 1.0e-8);
+    }
+}
+
+#endif
+
+} // namespace amr_wind_tests
@@ -0,0 +1,183 @@
+#include "aw_test_utils/MeshTest.H"
+#include "aw_test_utils/test_utils.H"
+#include "amr-wind/core/field_ops.H"
+#include "amr-wind/equation_systems/PDEBase.H"
+#include "amr-wind/equation_systems/PDEFields.H"
+#include "amr-wind/equation_systems/ScalarAdvectionBatch.H"
+#include "amr-wind/equation_systems/ScalarDiffusionBatch.H"
+
+namespace amr_wind_tests {
+
+class ScalarBatchTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+        {
+            amrex::ParmParse pp("incflo");
+            pp.add("use_godunov", 1);
+            pp.add("density", m_rho_0);
+        }
+    }
+
+    //! Register the scalar equations handled together by the batches
+    amrex::Vector<amr_wind::pde::PDEBase*> register_scalars()
+    {
+        populate_parameters();
+        initialize_mesh();
+
+        auto& pde_mgr = sim().pde_manager();
+        pde_mgr.register_icns();
+        sim().create_turbulence_model();
+        sim().init_physics();
+        return {
+            &pde_mgr.register_transport_pde("Temperature"),
+            &pde_mgr.register_transport_pde("PassiveScalar")};
+    }
+
+    static void init_scalar(
+        amr_wind::Field& scalar,
+        const amrex::Real fac,
+        const amrex::Real amp = 1.0)
+    {
+        const int nlevels = scalar.repo().num_active_levels();
+
+        for (int lev = 0; lev < nlevels; ++lev) {
+            const auto& sarrs = scalar(lev).arrays();
+
+            amrex::ParallelFor(
+                scalar(lev), scalar.num_grow(),
+                [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) {
+                    sarrs[nbx](i, j, k) =
+                        amp *
+                        (1. + fac * std::sin(0.7 * i) * std::cos(0.4 * j) +
+                         0.3 * std::cos(fac * k));
+                });
+        }
+        amrex::Gpu::streamSynchronize();
+    }
+
+    //! Check that a non-trivial reference matches the field, overwrites ref
+    static void check_matches(
+        amr_wind::ScratchField& ref,
+        const amr_wind::Field& field,
+        const amrex::Real tol,
+        const amrex::Real amp = 1.0)
+    {
+        EXPECT_GT(utils::field_max(ref) - utils::field_min(ref), 1.0e-3 * amp);
+        amr_wind::field_ops::saxpy(ref, -1.0, field, 0, 0, 1, 0);
+        const auto max_err =
+            amrex::max(utils::field_max(ref), -utils::field_min(ref));
+        EXPECT_NEAR(max_err, 0.0, tol * amp);
+    }
+
+    //! Compare the batched diffusion solve against one solve per scalar
+    void check_diffusion(const amrex::Vector<amrex::Real>& amp)
+    {
+        auto eqns = register_scalars();
+
+        auto& repo = sim().repo();
+        repo.get_field("density").setVal(m_rho_0);
+        auto& mask_cell = repo.declare_int_field("mask_cell", 1, 1);
+        mask_cell.setVal(1);
+
+        const amrex::Vector<amrex::Real> mu{{0.1, 0.4}};
+        for (int n = 0; n < 2; ++n) {
+            eqns[n]->fields().mueff.setVal(mu[n]);
+            eqns[n]->initialize();
+            EXPECT_TRUE(eqns[n]->supports_batched_diffusion());
+        }
+
+        // Reference solution with one solve per scalar
+        amrex::Vector<std::unique_ptr<amr_wind::ScratchField>> ref;
+        for (int n = 0; n < 2; ++n) {
+            auto& field = eqns[n]->fields().field;
+            init_scalar(field, 1.0 + n, amp[n]);
+            eqns[n]->solve(m_dt);
+            ref.push_back(repo.create_scratch_field(1, 0));
+            amr_wind::field_ops::copy(*ref[n], field, 0, 0, 1, 0);
+            init_scalar(field, 1.0 + n, amp[n]);
+        }
+
+        amr_wind::pde::ScalarDiffusionBatch batch(repo);
+        batch.solve(eqns, m_dt);
+
+        for (int n = 0; n < 2; ++n) {
+            check_matches(*ref[n], eqns[n]->fields().field, 1.0e-8, amp[n]);
+        }
+    }
+
+    const amrex::Real m_rho_0 = 1.2;
+    const amrex::Real m_dt = 0.1;
+};
+
+TEST_F(ScalarBatchTest, diffusion_matches_sequential)
+{
+    check_diffusion({1.0, 1.0});
+}
+
+TEST_F(ScalarBatchTest, diffusion_disparate_magnitudes)
+{
+    check_diffusion({300.0, 1.0e-3});
+}
+
+TEST_F(ScalarBatchTest, diffusion_field_options_not_batched)
+{
+    {
+        amrex::ParmParse pp("PassiveScalar_diffusion");
+        pp.add("mg_rtol", 1.0e-10);
+    }
+    auto eqns = register_scalars();
+    sim().repo().declare_int_field("mask_cell", 1, 1);
+    for (auto* eqn : eqns) {
+        eqn->initialize();
+    }
+
+    EXPECT_TRUE(eqns[0]->supports_batched_diffusion());
+    EXPECT_FALSE(eqns[1]->supports_batched_diffusion());
+}
+
+TEST_F(ScalarBatchTest, advection_matches_sequential)
+{
+    auto eqns = register_scalars();
+
+    sim().time().delta_t() = m_dt;
+
+    auto& repo = sim().repo();
+    auto& density = repo.get_field("density");
+    density.setVal(m_rho_0);
+    density.state(amr_wind::FieldState::NPH).setVal(m_rho_0);
+    repo.get_field("u_mac").setVal(1.0);
+    repo.get_field("v_mac").setVal(-0.5);
+    repo.get_field("w_mac").setVal(0.25);
+
+    for (int n = 0; n < 2; ++n) {
+        eqns[n]->initialize();
+        EXPECT_TRUE(eqns[n]->supports_batched_advection());
+
+        auto& fields = eqns[n]->fields();
+        init_scalar(fields.field.state(amr_wind::FieldState::Old), 1.0 + n);
+        init_scalar(fields.field.state(amr_wind::FieldState::NPH), 1.5 + n);
+        fields.src_term.setVal(0.1 * (n + 1));
+    }
+
+    // Reference advection terms computed one scalar at a time
+    amrex::Vector<std::unique_ptr<amr_wind::ScratchField>> ref;
+    for (int n = 0; n < 2; ++n) {
+        auto& conv_term = eqns[n]->fields().conv_term;
+        eqns[n]->compute_advection_term(amr_wind::FieldState::Old);
+        ref.push_back(repo.create_scratch_field(1, 0));
+        amr_wind::field_ops::copy(*ref[n], conv_term, 0, 0, 1, 0);
+        conv_term.setVal(0.0);
+    }
+
+    amr_wind::pde::ScalarAdvectionBatch batch(repo);
+    batch.compute(eqns, amr_wind::FieldState::Old, m_dt);
+
+    for (int n = 0; n < 2; ++n) {
+        check_matches(*ref[n], eqns[n]->fields().conv_term, 1.0e-12);
+    }
+}
+
+} // namespace amr_wind_tests
@@ -102,8 +102,14 @@ protected:
             amrex::ParmParse pp("amr");
             amrex::Vector<int> ncell{{m_nx, m_nx, m_nx}};
             pp.add("max_level", 0);
-            pp.add("max_grid_size", m_nx);
+            pp.add(
+                "max_grid_size",
+                m_max_grid_size > 0 ? m_max_grid_size : m_nx);
             pp.addarr("n_cell", ncell);
+            // The blocking factor must be a power of 2
+            if (m_max_grid_size > 0) {
+                pp.add("blocking_factor", m_max_grid_size);
+            }
         }
         {
             amrex::ParmParse pp("geometry");
@@ -131,12 +137,13 @@ protected:
         {
             amrex::ParmParse pp("VOF");
             pp.add("remove_debris", 0);
+            pp.add("narrow_band_advection", static_cast<int>(m_narrow_band));
         }
     }
 
     void testing_coorddir(const int dir, amrex::Real CFL)
     {
-        constexpr double tol = 1.0e-15;
+        const double tol = m_tol;
 
         // Flow-through time
         const amrex::Real ft_time = 1.0 / m_vel;
@@ -259,7 +266,10 @@ protected:
     const amrex::Real m_rho1 = 1000.0;
     const amrex::Real m_rho2 = 1.0;
     const amrex::Real m_vel = 5.0;
-    const int m_nx = 3;
+    int m_nx = 3;
+    int m_max_grid_size = 0; // defaults to a single box
+    bool m_narrow_band{false};
+    amrex::Real m_tol = 1.0e-15;
     amrex::Real m_dt = 0.0; // will be set according to CFL
 };
 
@@ -273,4 +283,16 @@ TEST_F(VOFConsTest, CFL01) { testing_coorddir(-1, 0.1); }
 // Test transport across multiple mesh levels - just check conservation
 TEST_F(VOFConsTest, 2level) { testing_coorddir(-2, 0.5 * 0.45); }
 
+// Boxes away from the interface are skipped, the slab must still be
+// transported exactly. Four boxes per direction, so that full and empty boxes
+// exist away from the interfaces of the slab.
+TEST_F(VOFConsTest, narrow_band)
+{
+    m_nx = 32;
+    m_max_grid_size = 8;
+    m_narrow_band = true;
+    m_tol = 1.0e-12;
+    testing_coorddir(0, 0.45);
+}
+
 } // namespace amr_wind_tests
@@ -1121,4 +1121,68 @@ TEST_F(VOFOversetOps, projection_masks)
     EXPECT_NEAR(error_cell, 0.0, 1e-10);
 }
 
+TEST_F(VOFOversetOps, sharpen_active_boxes)
+{
+    populate_parameters();
+    initialize_mesh();
+
+    auto& repo = sim().repo();
+    const int nghost = 3;
+    auto& vof = repo.declare_field("vof", 1, nghost);
+    auto& tg_vof = repo.declare_field("target_vof", 1, nghost);
+    auto& iblank = repo.declare_int_field("iblank_cell", 1, nghost);
+    auto& flux_x =
+        repo.declare_field("flux_x", 1, 0, 1, amr_wind::FieldLoc::XFACE);
+    auto& flux_y =
+        repo.declare_field("flux_y", 1, 0, 1, amr_wind::FieldLoc::YFACE);
+    auto& flux_z =
+        repo.declare_field("flux_z", 1, 0, 1, amr_wind::FieldLoc::ZFACE);
+    vof.setVal(0.0);
+    tg_vof.setVal(0.0);
+    iblank.setVal(1);
+    flux_y.setVal(0.0);
+    flux_z.setVal(0.0);
+
+    // Only the first cell is in the overset region and differs from target;
+    // the last cell differs from target too, but outside the overset region
+    run_algorithm(vof, [&](const int lev, const amrex::MFIter& mfi) {
+        auto vof_arr = vof(lev).array(mfi);
+        auto tgvof_arr = tg_vof(lev).array(mfi);
+        auto iblank_arr = iblank(lev).array(mfi);
+        const auto& bx = mfi.validbox();
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            if (i + j + k == 0 || i + j + k == 21) {
+                vof_arr(i, j, k) = 0.3;
+                tgvof_arr(i, j, k) = 0.5;
+            }
+            iblank_arr(i, j, k) = (i + j + k == 0) ? -1 : 1;
+        });
+    });
+
+    const auto flags =
+        amr_wind::overset_ops::flag_sharpen_boxes(vof(0), tg_vof(0), iblank(0));
+    int num_flagged = 0;
+    for (amrex::MFIter mfi(vof(0)); mfi.isValid(); ++mfi) {
+        const bool has_cell = mfi.validbox().contains(amrex::IntVect(0));
+        EXPECT_EQ(flags[mfi.LocalIndex()], has_cell ? 1 : 0);
+        num_flagged += flags[mfi.LocalIndex()];
+    }
+    amrex::ParallelDescriptor::ReduceIntSum(num_flagged);
+    EXPECT_EQ(num_flagged, 1);
+
+    // Reductions only consider the active boxes
+    for (amrex::MFIter mfi(vof(0)); mfi.isValid(); ++mfi) {
+        flux_x(0)[mfi].setVal<amrex::RunOn::Device>(
+            flags[mfi.LocalIndex()] != 0 ? 1.0 : 2.0);
+    }
+    amrex::Real err = amr_wind::overset_ops::measure_convergence(
+        flux_x(0), flux_y(0), flux_z(0), flags);
+    amrex::ParallelDescriptor::ReduceRealMax(err);
+    EXPECT_DOUBLE_EQ(err, 1.0);
+    err = amr_wind::overset_ops::measure_convergence(
+        flux_x(0), flux_y(0), flux_z(0));
+    amrex::ParallelDescriptor::ReduceRealMax(err);
+    EXPECT_DOUBLE_EQ(err, 2.0);
+}
+
 } // namespace amr_wind_tests
@@ -404,4 +404,46 @@ TEST_F(DiagnosticsTest, Field_Extrema)
     EXPECT_NEAR(fmax_l_bounded, gold_fmax_l, tol);
 }
 
+TEST_F(DiagnosticsTest, Field_Extrema_Single_Cell)
+{
+    populate_parameters();
+    {
+        // Several boxes so that the masked cell is on a single box and rank
+        amrex::ParmParse pp("amr");
+        pp.add("max_grid_size", 8);
+    }
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vof = repo.declare_field("vof", 1, 1);
+    auto& density = repo.declare_field("density", 1, 1);
+
+    // Liquid only in one cell, no gas anywhere
+    const amrex::IntVect iv_l{3, 5, 2};
+    const auto& farrs = vof(0).arrays();
+    const auto& rarrs = density(0).arrays();
+    amrex::ParallelFor(
+        vof(0), vof.num_grow(),
+        [=] AMREX_GPU_DEVICE(int nbx, int i, int j, int k) noexcept {
+            farrs[nbx](i, j, k) =
+                (amrex::IntVect(i, j, k) == iv_l) ? 1.0 : 0.5;
+            rarrs[nbx](i, j, k) = 1.0 + i + 10.0 * j + 100.0 * k;
+        });
+    amrex::Gpu::streamSynchronize();
+
+    // The mask value is found if it exists in any cell of any rank
+    amrex::Real fmin_l{0.}, fmax_l{0.}, fmin_g{0.}, fmax_g{0.};
+    const bool found_l = amr_wind::diagnostics::get_field_extrema(
+        fmax_l, fmin_l, density, vof, 1., 0, 1, 1);
+    const bool found_g = amr_wind::diagnostics::get_field_extrema(
+        fmax_g, fmin_g, density, vof, 0., 0, 1, 1);
+
+    EXPECT_TRUE(found_l);
+    EXPECT_FALSE(found_g);
+
+    const amrex::Real gold_rho_l = 1.0 + 3.0 + 10.0 * 5.0 + 100.0 * 2.0;
+    constexpr amrex::Real tol = 1.0e-12;
+    EXPECT_NEAR(fmax_l, gold_rho_l, tol);
+    EXPECT_NEAR(fmin_l, gold_rho_l, tol);
+}
+
 } // namespace amr_wind_tests
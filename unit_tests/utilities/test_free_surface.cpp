@@ -517,6 +517,52 @@ TEST_F(FreeSurfaceTest, plane)
     ASSERT_EQ(nout, npts * npts);
 }
 
+TEST_F(FreeSurfaceTest, plane_large)
+{
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vof = repo.declare_field("vof", 1, 2);
+    // Sample grid much finer than the mesh, with many points per column
+    constexpr int npts_large = 200;
+    {
+        amrex::ParmParse pp("freesurface");
+        pp.add("output_interval", 1);
+        pp.add("num_instances", 2);
+        pp.addarr(
+            "plane_num_points", amrex::Vector<int>{npts_large, npts_large});
+        pp.addarr("plane_start", m_pl_start);
+        pp.addarr("plane_end", m_pl_end);
+        // Up to 7 x 7 sample points lie in a single cell
+        pp.add("max_sample_points_per_cell", 49);
+    }
+
+    init_vof(vof, m_water_level1);
+    auto& m_sim = sim();
+    FreeSurfaceImpl tool(m_sim);
+    tool.initialize("freesurface");
+
+    // Time repeated searches, as done every output step
+    constexpr int nrepeat = 5;
+    const amrex::Real t_start = amrex::second();
+    for (int n = 0; n < nrepeat; ++n) {
+        tool.update_sampling_locations();
+    }
+    amrex::Real t_elapsed = (amrex::second() - t_start) / nrepeat;
+    amrex::ParallelDescriptor::ReduceRealMax(t_elapsed);
+    amrex::Print() << "FreeSurfaceSampler: " << npts_large * npts_large
+                   << " points, " << t_elapsed
+                   << " s per update of sampling locations" << std::endl;
+
+    // Check number of points
+    auto ngp = tool.num_gridpoints();
+    EXPECT_EQ(ngp, npts_large * npts_large);
+    // Check output values, no second interface
+    int nout = tool.check_output(0, "~", m_water_level1);
+    ASSERT_EQ(nout, npts_large * npts_large);
+    nout = tool.check_output(1, "=", m_problo[2]);
+    ASSERT_EQ(nout, npts_large * npts_large);
+}
+
 TEST_F(FreeSurfaceTest, multivalued)
 {
     initialize_mesh();
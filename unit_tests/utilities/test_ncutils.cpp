@@ -135,4 +135,36 @@ TEST(NetCDFUtils, var_io)
     }
 }
 
+TEST(NetCDFUtils, buffered_steps)
+{
+    constexpr int num_points = 4;
+    constexpr int num_steps = 3;
+    auto ncf_tmp =
+        ncutils::NCFile::create("test_steps.nc", NC_DISKLESS | NC_NETCDF4);
+    // The moved-from file must not be closed
+    ncutils::NCFile ncf(std::move(ncf_tmp));
+    ASSERT_GE(ncf.ncid, 0);
+
+    ncf.def_dim("nsteps", NC_UNLIMITED);
+    ncf.def_dim("nx", num_points);
+    auto var = ncf.def_var("vel", NC_DOUBLE, {"nsteps", "nx"});
+    var.set_chunking({num_steps, num_points});
+    var.set_deflate(4);
+    ncf.exit_def_mode();
+
+    // All the steps in a single write
+    std::vector<double> values(num_steps * num_points);
+    for (int i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<double>(i);
+    }
+    var.put(values.data(), {0, 0}, {num_steps, num_points});
+    ASSERT_EQ(ncf.dim("nsteps").len(), num_steps);
+
+    std::vector<double> step(num_points);
+    var.get(step.data(), {1, 0}, {1, num_points});
+    for (int i = 0; i < num_points; ++i) {
+        EXPECT_EQ(step[i], static_cast<double>(num_points + i));
+    }
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,74 @@
+#include "aw_test_utils/AmrexTest.H"
+#include "amr-wind/utilities/PerfLog.H"
+
+#include <cstdio>
+#include <fstream>
+
+namespace amr_wind_tests {
+
+namespace {
+
+void wait_for(const amrex::Real seconds)
+{
+    const amrex::Real start = amrex::ParallelDescriptor::second();
+    while (amrex::ParallelDescriptor::second() - start < seconds) {
+    }
+}
+
+} // namespace
+
+TEST(PerfLog, nested_phases)
+{
+    using amr_wind::PerfLog;
+    const std::string fname = std::string("./") + PerfLog::file_name;
+
+    // Timers are inactive until the log is opened
+    {
+        PerfLog::Timer timer(PerfLog::Advection);
+    }
+    EXPECT_FALSE(PerfLog::enabled());
+
+    PerfLog::initialize(".");
+    PerfLog::begin_step();
+    {
+        PerfLog::Timer adv(PerfLog::Advection);
+        wait_for(1.0e-3);
+        {
+            PerfLog::Timer mac(PerfLog::MACProjection);
+            wait_for(2.0e-3);
+        }
+    }
+    PerfLog::record_mlmg_iters("MAC_projection", 3);
+    PerfLog::record_mlmg_iters("MAC_projection", 2);
+
+    // Exclusive times: the MAC projection pauses the advection
+    const amrex::Real t_adv = PerfLog::local_time(PerfLog::Advection);
+    const amrex::Real t_mac = PerfLog::local_time(PerfLog::MACProjection);
+    EXPECT_GE(t_adv, 1.0e-3);
+    EXPECT_LT(t_adv, t_mac);
+    EXPECT_GE(t_mac, 2.0e-3);
+    EXPECT_EQ(PerfLog::local_time(PerfLog::Diffusion), 0.0);
+
+    PerfLog::end_step(1, 0.5, 0.5);
+    PerfLog::finalize();
+    EXPECT_FALSE(PerfLog::enabled());
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        std::ifstream ifh(fname);
+        std::string line;
+        std::string last;
+        while (std::getline(ifh, line)) {
+            last = line;
+        }
+        EXPECT_EQ(last.find("{\"step\":1,"), 0U);
+        EXPECT_NE(last.find("\"mac_projection\":{\"min\":"), std::string::npos);
+        EXPECT_NE(last.find("\"other\":{\"min\":"), std::string::npos);
+        EXPECT_NE(
+            last.find("\"mlmg_iters\":{\"MAC_projection\":5}"),
+            std::string::npos);
+        ifh.close();
+        std::remove(fname.c_str());
+    }
+}
+
+} // namespace amr_wind_tests
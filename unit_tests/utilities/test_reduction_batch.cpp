@@ -0,0 +1,35 @@
+#include "aw_test_utils/AmrexTest.H"
+#include "amr-wind/utilities/ReductionBatch.H"
+
+namespace amr_wind_tests {
+
+TEST(ReductionBatch, reduce)
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    const int rank = amrex::ParallelDescriptor::MyProc();
+    constexpr amrex::Real tol = 1.0e-12;
+
+    amr_wind::ReductionBatch batch;
+    // Several contributions on every process
+    for (int n = 0; n < 3; ++n) {
+        const amrex::Real val = 10.0 * rank + n;
+        batch.max("max", val);
+        batch.min("min", val);
+        batch.sum("sum", val);
+    }
+    const int idx = batch.max("rank", rank);
+    EXPECT_EQ(batch.size(), 4);
+    EXPECT_NEAR(batch.value("sum"), 30.0 * rank + 3.0, tol);
+
+    batch.reduce();
+    EXPECT_NEAR(batch.value("max"), 10.0 * (nprocs - 1) + 2.0, tol);
+    EXPECT_NEAR(batch.value("min"), 0.0, tol);
+    EXPECT_NEAR(
+        batch.value("sum"), 15.0 * nprocs * (nprocs - 1) + 3.0 * nprocs, tol);
+    EXPECT_NEAR(batch.value(idx), nprocs - 1, tol);
+
+    batch.clear();
+    EXPECT_EQ(batch.size(), 0);
+}
+
+} // namespace amr_wind_tests
@@ -3,12 +3,16 @@
 
 #include "amr-wind/utilities/sampling/Sampling.H"
 #include "amr-wind/utilities/sampling/SamplingContainer.H"
+#include "amr-wind/utilities/sampling/SamplingStencilCache.H"
+#include "amr-wind/utilities/sampling/LineSampler.H"
 #include "amr-wind/utilities/sampling/ProbeSampler.H"
 #include "amr-wind/utilities/sampling/PlaneSampler.H"
 #include "amr-wind/utilities/sampling/VolumeSampler.H"
 #include "amr-wind/utilities/sampling/DTUSpinnerSampler.H"
 #include "amr-wind/utilities/sampling/RadarSampler.H"
 #include "amr-wind/utilities/sampling/SamplingUtils.H"
+#include "amr-wind/utilities/ncutils/nc_interface.H"
+#include "amr-wind/utilities/IOManager.H"
 #include "AMReX_Vector.H"
 #include "amr-wind/core/vs/vector_space.H"
 #include "amr-wind/utilities/tensor_ops.H"
@@ -95,6 +99,23 @@ protected:
     }
 };
 
+//! Line sampler that keeps the points on the high faces of the domain
+class FaceLineSampler : public amr_wind::sampling::LineSampler
+{
+public:
+    using amr_wind::sampling::LineSampler::LineSampler;
+    using amr_wind::sampling::LineSampler::sampling_locations;
+
+    void check_bounds() override {}
+
+    void sampling_locations(
+        amr_wind::sampling::SampleLocType& sample_locs) const override
+    {
+        const auto& domain = m_sim.mesh().Geom(0).Domain();
+        sampling_locations(sample_locs, amrex::grow(domain, 1));
+    }
+};
+
 } // namespace
 
 class SamplingTest : public MeshTest
@@ -284,6 +305,117 @@ TEST_F(SamplingTest, sampling_timing)
     EXPECT_TRUE(probes.write_flag);
 }
 
+TEST_F(SamplingTest, stencil_cache)
+{
+    constexpr double tol = 1.0e-12;
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("velocity", 3, 2);
+    auto& pres = repo.declare_nd_field("pressure", 1, 2);
+    init_field(vel);
+    init_field(pres);
+
+    {
+        amrex::ParmParse pp("line1");
+        pp.add("num_points", 16);
+        pp.addarr("start", amrex::Vector<amrex::Real>{66.0, 66.0, 1.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{66.0, 66.0, 127.0});
+    }
+    {
+        amrex::ParmParse pp("line2");
+        pp.add("num_points", 21);
+        pp.addarr("start", amrex::Vector<amrex::Real>{1.0, 2.0, 3.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{120.0, 100.0, 90.0});
+    }
+
+    amrex::Vector<std::unique_ptr<amr_wind::sampling::SamplerBase>> samplers;
+    long num_points = 0;
+    for (const std::string lbl : {"line1", "line2"}) {
+        auto obj = std::make_unique<amr_wind::sampling::LineSampler>(sim());
+        obj->initialize(lbl);
+        obj->id() = static_cast<int>(samplers.size());
+        num_points += obj->num_points();
+        EXPECT_TRUE(obj->fixed_locations());
+        samplers.emplace_back(std::move(obj));
+    }
+
+    const amrex::Vector<amr_wind::Field*> fields{&vel, &pres};
+    const int ncomp = 4;
+
+    amr_wind::sampling::SamplingContainer sc(mesh());
+    sc.setup_container(ncomp);
+    sc.initialize_particles(samplers);
+    sc.Redistribute();
+    sc.interpolate_fields(fields, 0);
+    std::vector<double> buf_ref(num_points * ncomp, 0.0);
+    sc.populate_buffer(buf_ref);
+
+    amr_wind::sampling::SamplingStencilCache cache(mesh());
+    cache.build(samplers, ncomp);
+    cache.interpolate_fields(fields, 0);
+    std::vector<double> buf(num_points * ncomp, 0.0);
+    cache.populate_buffer(buf);
+
+    int num_local = cache.num_local_points();
+    amrex::ParallelDescriptor::ReduceIntSum(num_local);
+    EXPECT_EQ(num_local, num_points);
+
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        for (int i = 0; i < buf.size(); ++i) {
+            EXPECT_NEAR(buf[i], buf_ref[i], tol);
+        }
+    }
+}
+
+TEST_F(SamplingTest, stencil_cache_domain_face)
+{
+    constexpr double tol = 1.0e-12;
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("velocity", 3, 2);
+    auto& pres = repo.declare_nd_field("pressure", 1, 2);
+    init_field(vel);
+    init_field(pres);
+
+    // The last point lies on the high faces of the domain
+    {
+        amrex::ParmParse pp("line1");
+        pp.add("num_points", 5);
+        pp.addarr("start", amrex::Vector<amrex::Real>{64.0, 96.0, 0.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{128.0, 128.0, 128.0});
+    }
+
+    amrex::Vector<std::unique_ptr<amr_wind::sampling::SamplerBase>> samplers;
+    auto obj = std::make_unique<FaceLineSampler>(sim());
+    obj->initialize("line1");
+    obj->id() = 0;
+    const long num_points = obj->num_points();
+    samplers.emplace_back(std::move(obj));
+
+    const amrex::Vector<amr_wind::Field*> fields{&vel, &pres};
+    const int ncomp = 4;
+
+    amr_wind::sampling::SamplingStencilCache cache(mesh());
+    cache.build(samplers, ncomp);
+    cache.interpolate_fields(fields, 0);
+    std::vector<double> buf(num_points * ncomp, 0.0);
+    cache.populate_buffer(buf);
+
+    int num_local = cache.num_local_points();
+    amrex::ParallelDescriptor::ReduceIntSum(num_local);
+    EXPECT_EQ(num_local, num_points);
+
+    // The fields are linear, so the interpolation is exact
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        for (int i = 0; i < num_points; ++i) {
+            const amrex::Real expected = 160.0 + 56.0 * i;
+            for (int n = 0; n < ncomp; ++n) {
+                EXPECT_NEAR(buf[n * num_points + i], expected, tol);
+            }
+        }
+    }
+}
+
 TEST_F(SamplingTest, probe_sampler)
 {
     initialize_mesh();
@@ -484,4 +616,109 @@ TEST_F(SamplingTest, quadrature)
     EXPECT_NEAR(weights[20], 6.6402168628164281e-07, toler);
 }
 
+TEST_F(SamplingTest, gather_buffer)
+{
+    constexpr double tol = 1.0e-12;
+    initialize_mesh();
+    auto& repo = sim().repo();
+    auto& vel = repo.declare_field("velocity", 3, 2);
+    init_field(vel);
+
+    {
+        amrex::ParmParse pp("line1");
+        pp.add("num_points", 21);
+        pp.addarr("start", amrex::Vector<amrex::Real>{1.0, 2.0, 3.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{120.0, 100.0, 90.0});
+    }
+
+    amrex::Vector<std::unique_ptr<amr_wind::sampling::SamplerBase>> samplers;
+    auto obj = std::make_unique<amr_wind::sampling::LineSampler>(sim());
+    obj->initialize("line1");
+    const long num_points = obj->num_points();
+    samplers.emplace_back(std::move(obj));
+
+    const amrex::Vector<amr_wind::Field*> fields{&vel};
+    const int ncomp = 3;
+
+    amr_wind::sampling::SamplingContainer sc(mesh());
+    sc.setup_container(ncomp);
+    sc.initialize_particles(samplers);
+    sc.Redistribute();
+    sc.num_sampling_particles() = num_points;
+    sc.interpolate_fields(fields, 0);
+    std::vector<double> buf_ref(num_points * ncomp, 0.0);
+    sc.populate_buffer(buf_ref);
+
+    // The buffer is only needed on the I/O processor
+    const bool is_ioproc = amrex::ParallelDescriptor::IOProcessor();
+    std::vector<double> buf(is_ioproc ? num_points * ncomp : 0, -1.0);
+    sc.gather_buffer(buf);
+
+    if (is_ioproc) {
+        for (int i = 0; i < buf.size(); ++i) {
+            EXPECT_NEAR(buf[i], buf_ref[i], tol);
+        }
+    }
+}
+
+#ifdef AMR_WIND_USE_NETCDF
+TEST_F(SamplingTest, netcdf_buffered_steps)
+{
+    constexpr double tol = 1.0e-12;
+    constexpr int num_points = 4;
+    constexpr int num_steps = 5;
+    initialize_mesh();
+    auto& rho = sim().repo().declare_field("density", 1, 2);
+
+    {
+        amrex::ParmParse pp("sampling");
+        pp.add("output_interval", 1);
+        pp.add("output_format", std::string("netcdf"));
+        pp.add("netcdf_buffer_steps", 3);
+        pp.addarr("labels", amrex::Vector<std::string>{"line1"});
+        pp.addarr("fields", amrex::Vector<std::string>{"density"});
+    }
+    {
+        amrex::ParmParse pp("sampling.line1");
+        pp.add("type", std::string("LineSampler"));
+        pp.add("num_points", num_points);
+        pp.addarr("start", amrex::Vector<amrex::Real>{66.0, 66.0, 1.0});
+        pp.addarr("end", amrex::Vector<amrex::Real>{66.0, 66.0, 127.0});
+    }
+
+    // Two steps remain in the buffer and are written by the destructor
+    const std::string ncfile =
+        sim().io_manager().post_processing_directory() + "/" +
+        amrex::Concatenate("sampling", sim().time().time_index()) + ".nc";
+    std::vector<double> times;
+    {
+        amr_wind::sampling::Sampling probes(sim(), "sampling");
+        probes.initialize();
+        for (int n = 0; n < num_steps; ++n) {
+            rho.setVal(1.0 + n);
+            probes.output_actions();
+            times.push_back(sim().time().new_time());
+        }
+    }
+
+    if (!amrex::ParallelDescriptor::IOProcessor()) {
+        return;
+    }
+    auto ncf = ncutils::NCFile::open(ncfile, NC_NOWRITE);
+    ASSERT_EQ(ncf.dim("num_time_steps").len(), num_steps);
+
+    std::vector<double> nc_times(num_steps);
+    ncf.var("time").get(nc_times.data(), {0}, {num_steps});
+    auto grp = ncf.group("line1");
+    std::vector<double> values(num_steps * num_points);
+    grp.var("density").get(values.data(), {0, 0}, {num_steps, num_points});
+    for (int n = 0; n < num_steps; ++n) {
+        EXPECT_NEAR(nc_times[n], times[n], tol);
+        for (int i = 0; i < num_points; ++i) {
+            EXPECT_NEAR(values[n * num_points + i], 1.0 + n, tol);
+        }
+    }
+}
+#endif
+
 } // namespace amr_wind_tests
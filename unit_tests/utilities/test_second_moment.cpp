@@ -10,6 +10,8 @@
 
 #include "amr-wind/utilities/FieldPlaneAveraging.H"
 #include "amr-wind/utilities/SecondMomentAveraging.H"
+#include "amr-wind/utilities/ThirdMomentAveraging.H"
+#include "amr-wind/utilities/PlaneAveragingBatch.H"
 #include "amr-wind/utilities/trig_ops.H"
 
 namespace amr_wind_tests {
@@ -254,4 +256,86 @@ TEST_F(SecondMomentAveragingTest, test_xdir) { test_dir(0); }
 TEST_F(SecondMomentAveragingTest, test_ydir) { test_dir(1); }
 TEST_F(SecondMomentAveragingTest, test_zdir) { test_dir(2); }
 
+TEST_F(SecondMomentAveragingTest, test_batch)
+{
+    constexpr double tol = 1.0e-10;
+    constexpr int dir = 2;
+
+    populate_parameters();
+    initialize_mesh();
+
+    auto& frepo = mesh().field_repo();
+    auto& velocityf = frepo.declare_field("velocity", 3);
+    auto& temperaturef = frepo.declare_field("temperature", 1);
+    auto velocity = velocityf.vec_ptrs();
+    auto temperature = temperaturef.vec_ptrs();
+
+    velocity[0]->setVal(8.0, 0, 1);
+    velocity[0]->setVal(3.0, 1, 1);
+    velocity[0]->setVal(0.5, 2, 1);
+    temperature[0]->setVal(300.0);
+
+    const auto& problo = mesh().Geom(0).ProbLoArray();
+    const auto& probhi = mesh().Geom(0).ProbHiArray();
+    amrex::GpuArray<amrex::Real, AMREX_SPACEDIM> a;
+    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+        a[d] = 2.0 * amr_wind::utils::two_pi() / (probhi[d] - problo[d]);
+    }
+
+    run_algorithm(
+        mesh().num_levels(), velocity,
+        [&](const int lev, const amrex::MFIter& mfi) {
+            auto vel = velocity[lev]->array(mfi);
+            auto theta = temperature[lev]->array(mfi);
+            const auto& bx = mfi.validbox();
+            add_periodic(a, mesh().Geom(lev), bx, vel);
+
+            amrex::ParallelFor(
+                bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+                    theta(i, j, k) += 0.1 * vel(i, j, k, 0) * vel(i, j, k, 2);
+                });
+        });
+
+    // Reference values from the individual averaging operations
+    amr_wind::VelPlaneAveraging pa_vel(sim(), dir);
+    amr_wind::FieldPlaneAveraging pa_temp(temperaturef, sim().time(), dir);
+    pa_vel();
+    pa_temp();
+    amr_wind::SecondMomentAveraging tu(pa_vel, pa_temp);
+    amr_wind::SecondMomentAveraging uu(pa_vel, pa_vel);
+    amr_wind::ThirdMomentAveraging uuu(pa_vel, pa_vel, pa_vel);
+    tu();
+    uu();
+    uuu();
+
+    amr_wind::VelPlaneAveraging bpa_vel(sim(), dir);
+    amr_wind::FieldPlaneAveraging bpa_temp(temperaturef, sim().time(), dir);
+    amr_wind::SecondMomentAveraging btu(bpa_vel, bpa_temp);
+    amr_wind::SecondMomentAveraging buu(bpa_vel, bpa_vel);
+    amr_wind::ThirdMomentAveraging buuu(bpa_vel, bpa_vel, bpa_vel);
+    amr_wind::PlaneAveragingBatch batch;
+    batch.add(btu);
+    batch.add(buu);
+    batch.add(buuu);
+
+    const auto check = [tol](const auto& ref, const auto& val) {
+        ASSERT_EQ(ref.size(), val.size());
+        for (size_t i = 0; i < ref.size(); ++i) {
+            EXPECT_NEAR(ref[i], val[i], tol);
+        }
+    };
+
+    // The second evaluation uses the previous averages as shifts
+    for (int n = 0; n < 2; ++n) {
+        batch();
+        check(pa_vel.line_average(), bpa_vel.line_average());
+        check(pa_vel.line_deriv(), bpa_vel.line_deriv());
+        check(pa_vel.line_hvelmag_average(), bpa_vel.line_hvelmag_average());
+        check(pa_temp.line_average(), bpa_temp.line_average());
+        check(tu.line_moment(), btu.line_moment());
+        check(uu.line_moment(), buu.line_moment());
+        check(uuu.line_moment(), buuu.line_moment());
+    }
+}
+
 } // namespace amr_wind_tests
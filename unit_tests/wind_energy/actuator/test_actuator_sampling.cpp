@@ -6,6 +6,7 @@
 #include "amr-wind/core/vs/vector_space.H"
 
 #include <algorithm>
+#include <set>
 
 namespace amr_wind_tests {
 namespace {
@@ -21,6 +22,12 @@ public:
 
     // Accessor for the particle data holder object
     amr_wind::actuator::ActuatorCloud& get_data_obj() { return point_data(); }
+
+    // Accessor for the point map
+    const amr_wind::actuator::ActuatorPointMap& get_point_map() const
+    {
+        return point_map();
+    }
 };
 
 class ActuatorTest : public MeshTest
@@ -168,4 +175,88 @@ TEST_F(ActuatorTest, act_container)
     }
 }
 
+TEST_F(ActuatorTest, act_container_point_map)
+{
+    const int nprocs = amrex::ParallelDescriptor::NProcs();
+    if (nprocs > 2) {
+        GTEST_SKIP();
+    }
+
+    const int iproc = amrex::ParallelDescriptor::MyProc();
+    initialize_mesh();
+    auto& vel = sim().repo().declare_field("velocity", 3, 3);
+    auto& density = sim().repo().declare_field("density", 1, 3);
+    init_field(vel);
+    density.setVal(1.0);
+
+    const int num_turbines = 2;
+    const int num_nodes = 16;
+
+    TestActContainer ac(mesh(), num_turbines);
+    auto& data = ac.get_data_obj();
+    for (int it = 0; it < num_turbines; ++it) {
+        data.num_pts[it] = num_nodes;
+    }
+
+    std::set<int> procs;
+    for (int ip = 0; ip < nprocs; ++ip) {
+        procs.insert(ip);
+    }
+    ac.use_point_map(procs);
+    ac.initialize_container();
+
+    const amrex::Real dz = mesh().Geom(0).CellSize(2);
+    const auto set_positions = [&](const amrex::Real xoff,
+                                   const amrex::Real zoff) {
+        int idx = 0;
+        const amrex::Real ypos = 32.0 * (iproc + 1);
+        auto& pvec = data.position;
+        for (int it = 0; it < num_turbines; ++it) {
+            const amrex::Real xpos = 32.0 * (it + 1) + xoff;
+            for (int ni = 0; ni < num_nodes; ++ni) {
+                pvec[idx].x() = xpos;
+                pvec[idx].y() = ypos;
+                pvec[idx].z() = (ni + 0.5) * dz + zoff;
+                ++idx;
+            }
+        }
+    };
+
+    const auto check_velocities = [&]() {
+        namespace vs = amr_wind::vs;
+        constexpr amrex::Real rtol = 1.0e-12;
+        amrex::Real rerr = 0.0;
+        const int npts = ac.num_actuator_points();
+        for (int ip = 0; ip < npts; ++ip) {
+            const auto& pos = data.position[ip];
+            const amrex::Real vval = pos.x() + pos.y() + pos.z();
+            const vs::Vector vgold{vval, vval, vval};
+            rerr += vs::mag_sqr(data.velocity[ip] - vgold);
+            EXPECT_NEAR(data.density[ip], 1.0, rtol);
+        }
+        EXPECT_NEAR(rerr, 0.0, rtol);
+    };
+
+    // All points are located on the first update
+    set_positions(0.0, 0.0);
+    ac.update_positions();
+    EXPECT_EQ(ac.get_point_map().num_relocated(), ac.num_actuator_points());
+    ac.sample_fields(vel, density);
+    check_velocities();
+
+    // Points moving within their cells keep their owners
+    set_positions(0.0, 0.25 * dz);
+    ac.update_positions();
+    EXPECT_EQ(ac.get_point_map().num_relocated(), 0);
+    ac.sample_fields(vel, density);
+    check_velocities();
+
+    // Only the points of the first turbine move to the next box along x
+    set_positions(40.0, 0.25 * dz);
+    ac.update_positions();
+    EXPECT_EQ(ac.get_point_map().num_relocated(), num_nodes);
+    ac.sample_fields(vel, density);
+    check_velocities();
+}
+
 } // namespace amr_wind_tests
@@ -0,0 +1,103 @@
+#include "aw_test_utils/AmrexTest.H"
+#include "amr-wind/wind_energy/actuator/spreading_bins.H"
+#include "AMReX_Reduce.H"
+
+namespace amr_wind_tests {
+namespace {
+
+namespace act = ::amr_wind::actuator;
+namespace vs = ::amr_wind::vs;
+
+//! Points along two perpendicular lines, similar to a two-bladed rotor
+act::VecList line_points(const int npts)
+{
+    act::VecList pos;
+    for (int i = 0; i < npts; ++i) {
+        const amrex::Real s = -1.0 + 2.0 * i / (npts - 1);
+        pos.emplace_back(0.1, s, 0.2);
+        pos.emplace_back(0.1, 0.3, s);
+    }
+    return pos;
+}
+
+//! Return the number of points found within the radius of cell centers by
+//! the bins and by a brute force search, and the number of points visited
+amrex::GpuArray<int, 3> count_points(
+    const act::VecList& pos,
+    const act::utils::SpreadingBins& bins,
+    const amrex::Real radius)
+{
+    const int npts = static_cast<int>(pos.size());
+    act::DeviceVecList dpos(pos.size());
+    amrex::Gpu::copy(
+        amrex::Gpu::hostToDevice, pos.begin(), pos.end(), dpos.begin());
+    const auto* pp = dpos.data();
+    const auto view = bins.view();
+
+    const amrex::Box bx(amrex::IntVect(0), amrex::IntVect(15));
+    const amrex::Real dx = 3.0 / 16.0;
+    const amrex::Real rad_sqr = radius * radius;
+
+    amrex::ReduceOps<amrex::ReduceOpSum, amrex::ReduceOpSum, amrex::ReduceOpSum>
+        reduce_op;
+    amrex::ReduceData<int, int, int> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+    reduce_op.eval(
+        bx, reduce_data,
+        [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+            const vs::Vector cc{
+                -1.5 + (i + 0.5) * dx, -1.5 + (j + 0.5) * dx,
+                -1.5 + (k + 0.5) * dx};
+
+            int nbins = 0;
+            int nvisit = 0;
+            view.for_each_near(cc, [&](const int ip) {
+                ++nvisit;
+                nbins += (vs::mag_sqr(cc - pp[ip]) < rad_sqr) ? 1 : 0;
+            });
+
+            int nbrute = 0;
+            for (int ip = 0; ip < npts; ++ip) {
+                nbrute += (vs::mag_sqr(cc - pp[ip]) < rad_sqr) ? 1 : 0;
+            }
+            return {nbins, nbrute, nvisit};
+        });
+    const auto result = reduce_data.value();
+    return {
+        amrex::get<0>(result), amrex::get<1>(result), amrex::get<2>(result)};
+}
+
+} // namespace
+
+class SpreadingBinsTest : public AmrexTest
+{};
+
+TEST_F(SpreadingBinsTest, finds_all_points_within_radius)
+{
+    const auto pos = line_points(41);
+    const amrex::Real radius = 0.25;
+    act::utils::SpreadingBins bins;
+    bins.build(pos, radius);
+
+    const auto counts = count_points(pos, bins, radius);
+    const int ncells = 16 * 16 * 16;
+    const int npts = static_cast<int>(pos.size());
+    EXPECT_GT(counts[1], 0);
+    EXPECT_EQ(counts[0], counts[1]);
+    EXPECT_LT(counts[2], ncells * npts / 10);
+}
+
+TEST_F(SpreadingBinsTest, visits_all_points_without_cutoff)
+{
+    const auto pos = line_points(11);
+    act::utils::SpreadingBins bins;
+    bins.build(pos, -1.0);
+
+    const auto counts = count_points(pos, bins, 0.25);
+    const int ncells = 16 * 16 * 16;
+    const int npts = static_cast<int>(pos.size());
+    EXPECT_EQ(counts[0], counts[1]);
+    EXPECT_EQ(counts[2], ncells * npts);
+}
+
+} // namespace amr_wind_tests
@@ -8,6 +8,7 @@
 #include "amr-wind/equation_systems/icns/icns.H"
 #include "amr-wind/equation_systems/icns/icns_ops.H"
 #include "amr-wind/equation_systems/icns/MomentumSource.H"
+#include "amr-wind/equation_systems/FusedSourceTerms.H"
 #include "amr-wind/equation_systems/icns/source_terms/BodyForce.H"
 #include "amr-wind/equation_systems/icns/source_terms/ABLForcing.H"
 #include "amr-wind/equation_systems/icns/source_terms/GeostrophicForcing.H"
@@ -699,4 +700,67 @@ TEST_F(ABLMeshTest, densitybuoyancy)
     EXPECT_NEAR(utils::field_max(src_term, 2), -9.81 * (1.0 - 1.0 / 0.5), tol);
 }
 
+TEST_F(ABLMeshTest, fused_source_terms)
+{
+    constexpr amrex::Real tol = 1.0e-12;
+    populate_parameters();
+    initialize_mesh();
+
+    auto& pde_mgr = sim().pde_manager();
+    pde_mgr.register_icns();
+    sim().init_physics();
+
+    auto& src_term = pde_mgr.icns().fields().src_term;
+    auto& velocity = sim().repo().get_field("velocity");
+    velocity.setVal({{8.0, 0.0, -1.0}});
+    run_algorithm(velocity, [&](const int lev, const amrex::MFIter& mfi) {
+        cor_height_init_vel_field(mfi.validbox(), velocity(lev).array(mfi));
+    });
+
+    amr_wind::pde::icns::CoriolisForcing coriolis(sim());
+    amr_wind::pde::icns::RayleighDamping rayleigh_damping(sim());
+    amr_wind::pde::icns::RayleighDamping rayleigh_damping_dup(sim());
+
+    // Reference from the individual kernels
+    src_term.setVal(0.0);
+    run_algorithm(src_term, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& bx = mfi.tilebox();
+        const auto& src_arr = src_term(lev).array(mfi);
+        coriolis(lev, mfi, bx, amr_wind::FieldState::New, src_arr);
+        rayleigh_damping(lev, mfi, bx, amr_wind::FieldState::New, src_arr);
+    });
+    amrex::MultiFab ref(
+        src_term(0).boxArray(), src_term(0).DistributionMap(),
+        AMREX_SPACEDIM, 0);
+    amrex::MultiFab::Copy(ref, src_term(0), 0, 0, AMREX_SPACEDIM, 0);
+
+    amr_wind::pde::FusedSourceTerms<
+        amr_wind::pde::MomentumSource,
+        amr_wind::pde::icns::CoriolisForcing,
+        amr_wind::pde::icns::RayleighDamping>
+        fused;
+    EXPECT_TRUE(fused.empty());
+    EXPECT_TRUE(fused.add(rayleigh_damping));
+    EXPECT_TRUE(fused.add(coriolis));
+    // Only one instance of each type can be fused
+    EXPECT_FALSE(fused.add(rayleigh_damping_dup));
+    EXPECT_FALSE(fused.empty());
+
+    src_term.setVal(0.0);
+    run_algorithm(src_term, [&](const int lev, const amrex::MFIter& mfi) {
+        const auto& bx = mfi.tilebox();
+        const auto& src_arr = src_term(lev).array(mfi);
+        const auto op = fused.device_op(lev, mfi, amr_wind::FieldState::New);
+        amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) {
+            op(i, j, k, src_arr);
+        });
+    });
+
+    amrex::MultiFab::Subtract(ref, src_term(0), 0, 0, AMREX_SPACEDIM, 0);
+    for (int i = 0; i < AMREX_SPACEDIM; ++i) {
+        EXPECT_NEAR(ref.norm0(i), 0.0, tol);
+    }
+    EXPECT_GT(utils::field_max(src_term, 0), 0.0);
+}
+
 } // namespace amr_wind_tests
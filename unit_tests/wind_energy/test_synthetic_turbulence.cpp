@@ -0,0 +1,161 @@
+#include "aw_test_utils/MeshTest.H"
+#include "amr-wind/physics/SyntheticTurbulence.H"
+#include "amr-wind/utilities/ncutils/nc_interface.H"
+
+namespace amr_wind_tests {
+
+namespace {
+
+const std::string turb_file{"synth_turb.nc"};
+constexpr int nx = 6;
+constexpr int ny = 4;
+constexpr int nz = 5;
+
+//! Write a small turbulence box with distinct values in every plane
+void write_turb_file()
+{
+    if (amrex::ParallelDescriptor::IOProcessor()) {
+        auto ncf = ncutils::NCFile::create(turb_file, NC_CLOBBER | NC_NETCDF4);
+        ncf.def_dim("ndim", AMREX_SPACEDIM);
+        ncf.def_dim("nx", nx);
+        ncf.def_dim("ny", ny);
+        ncf.def_dim("nz", nz);
+        const std::vector<std::string> three_dim{"nx", "ny", "nz"};
+        auto box_len = ncf.def_var("box_lengths", NC_DOUBLE, {"ndim"});
+        auto dx = ncf.def_var("dx", NC_DOUBLE, {"ndim"});
+        auto uvel = ncf.def_var("uvel", NC_DOUBLE, three_dim);
+        auto vvel = ncf.def_var("vvel", NC_DOUBLE, three_dim);
+        auto wvel = ncf.def_var("wvel", NC_DOUBLE, three_dim);
+        ncf.exit_def_mode();
+
+        const std::vector<double> lengths{nx, ny, nz};
+        const std::vector<double> spacing{1.0, 1.0, 1.0};
+        box_len.put(lengths.data());
+        dx.put(spacing.data());
+
+        std::vector<double> u(nx * ny * nz), v(nx * ny * nz), w(nx * ny * nz);
+        for (int i = 0; i < nx; ++i) {
+            for (int j = 0; j < ny; ++j) {
+                for (int k = 0; k < nz; ++k) {
+                    const int idx = (i * ny + j) * nz + k;
+                    u[idx] = 100.0 * i + 10.0 * j + k;
+                    v[idx] = -u[idx];
+                    w[idx] = 0.5 * u[idx];
+                }
+            }
+        }
+        const std::vector<size_t> start{0, 0, 0};
+        const std::vector<size_t> count{nx, ny, nz};
+        uvel.put(u.data(), start, count);
+        vvel.put(v.data(), start, count);
+        wvel.put(w.data(), start, count);
+    }
+    amrex::ParallelDescriptor::Barrier();
+}
+
+//! Read a plane on the calling rank, as done before the planes were cached
+void read_plane(
+    const std::string& vname, const int il, std::vector<double>& plane)
+{
+    auto ncf = ncutils::NCFile::open(turb_file, NC_NOWRITE);
+    plane.resize(ny * nz);
+    ncf.var(vname).get(
+        plane.data(), {static_cast<size_t>(il), 0, 0}, {1, ny, nz});
+}
+
+} // namespace
+
+class SyntheticTurbulenceTest : public MeshTest
+{
+protected:
+    void populate_parameters() override
+    {
+        MeshTest::populate_parameters();
+
+        {
+            amrex::ParmParse pp("SynthTurb");
+            pp.add("turbulence_file", turb_file);
+            pp.add("mean_wind_type", std::string("ConstValue"));
+            pp.add("wind_direction", 270.0);
+            pp.addarr(
+                "grid_location", amrex::Vector<amrex::Real>{4.0, 4.0, 4.0});
+            pp.add("gauss_smearing_factor", 2.0);
+        }
+        {
+            amrex::ParmParse pp("ConstValue.velocity");
+            pp.addarr("value", amrex::Vector<amrex::Real>{1.0, 0.0, 0.0});
+        }
+    }
+
+    //! Check the bounding planes against direct reads over several passes
+    //! through the box
+    void check_planes()
+    {
+        write_turb_file();
+        initialize_mesh();
+        auto& repo = sim().repo();
+        repo.declare_field("velocity", 3, 0);
+        repo.declare_field("density", 1, 0).setVal(1.0);
+
+        amr_wind::SyntheticTurbulence synth(sim());
+
+        std::vector<double> plane;
+        const size_t plane_size = ny * nz;
+        for (int n = 0; n < 3 * nx; ++n) {
+            // Unit mean velocity, so the box advances one plane per step
+            sim().time().set_restart_time(n, n + 0.5);
+            synth.pre_advance_work();
+
+            const auto& grid = synth.turb_grid();
+            const int il = n % nx;
+            const int ir = (n + 1) % nx;
+            ASSERT_EQ(grid.ileft, il);
+            ASSERT_EQ(grid.iright, ir);
+
+            const std::vector<std::string> vnames{"uvel", "vvel", "wvel"};
+            const std::vector<const amrex::Vector<double>*> vels{
+                &grid.uvel, &grid.vvel, &grid.wvel};
+            for (int iv = 0; iv < 3; ++iv) {
+                const auto& vel = *vels[iv];
+                read_plane(vnames[iv], il, plane);
+                for (size_t m = 0; m < plane_size; ++m) {
+                    EXPECT_EQ(vel[m], plane[m]);
+                }
+                read_plane(vnames[iv], ir, plane);
+                for (size_t m = 0; m < plane_size; ++m) {
+                    EXPECT_EQ(vel[plane_size + m], plane[m]);
+                }
+            }
+        }
+    }
+};
+
+TEST_F(SyntheticTurbulenceTest, planes_default)
+{
+    populate_parameters();
+    check_planes();
+}
+
+TEST_F(SyntheticTurbulenceTest, planes_prefetch)
+{
+    // The cache holds 5 of the 6 planes, so the box wraps around the cache
+    // and cached planes are evicted while the box advances
+    populate_parameters();
+    {
+        amrex::ParmParse pp("SynthTurb");
+        pp.add("prefetch_planes", 3);
+    }
+    check_planes();
+}
+
+TEST_F(SyntheticTurbulenceTest, planes_resident)
+{
+    populate_parameters();
+    {
+        amrex::ParmParse pp("SynthTurb");
+        pp.add("max_resident_size", 1.0);
+    }
+    check_planes();
+}
+
+} // namespace amr_wind_tests